@@ -752,6 +752,19 @@ static hal_imumc_status_t HAL_ImuFreeRxBuf(hal_imu_handle_t *imuHandle, uint8_t
     return imumcStatus;
 }
 
+hal_imumc_status_t HAL_ImuReturnRxBuf(imu_link_t link, uint8_t *rxBuf)
+{
+    hal_imu_handle_t *imuHandle;
+    uint32_t rxBufAddr;
+
+    assert(kIMU_LinkMax > link);
+    assert(NULL != rxBuf);
+    imuHandle = &imuHandleCh[link];
+
+    rxBufAddr = (uint32_t)rxBuf;
+    return HAL_ImuFreeRxBuf(imuHandle, (uint8_t *)&rxBufAddr, 1U);
+}
+
 hal_imumc_status_t HAL_ImuSendCommand(uint8_t imuLink, uint8_t *cmdBuf, uint32_t length)
 {
     hal_imumc_status_t imumcStatus = kStatus_HAL_ImumcSuccess;
@@ -1190,6 +1203,8 @@ hal_imumc_status_t HAL_ImuReceive(uint8_t imuLink)
     hal_imumc_state_t *ept;
     struct imumc_std_msg *imumc_msg;
     hal_imumc_status_t imumcStatus = kStatus_HAL_ImumcSuccess;
+    uint8_t rxBufCnt;
+    uint8_t i;
 
     assert((uint8_t)kIMU_LinkMax > imuLink);
     imuHandle = &imuHandleCh[imuLink];
@@ -1267,8 +1282,22 @@ hal_imumc_status_t HAL_ImuReceive(uint8_t imuLink)
                     {
                         imumcStatus = imuHandle->imuHandler[IMU_MSG_RX_DATA]((IMU_Msg_t *)pMsg, pMsg->Hdr.length);
                     }
-                    pMsg        = &localImuMsgRx;
-                    imumcStatus = HAL_ImuFreeRxBuf(imuHandle, (uint8_t *)&pMsg->PayloadPtr[0], pMsg->Hdr.length);
+                    /* Rx buffers whose payload pointer was cleared by the handler are held by
+                     * the upper layer and will be returned later by HAL_ImuReturnRxBuf() */
+                    rxBufCnt = 0;
+                    for (i = 0; i < localImuMsgRx.Hdr.length; i++)
+                    {
+                        if (pMsg->PayloadPtr[i] != 0U)
+                        {
+                            localImuMsgRx.PayloadPtr[rxBufCnt] = localImuMsgRx.PayloadPtr[i];
+                            rxBufCnt++;
+                        }
+                    }
+                    pMsg = &localImuMsgRx;
+                    if (rxBufCnt != 0U)
+                    {
+                        imumcStatus = HAL_ImuFreeRxBuf(imuHandle, (uint8_t *)&pMsg->PayloadPtr[0], rxBufCnt);
+                    }
                     break;
                 case IMU_MSG_IMUMC:
                     imumc_msg = (struct imumc_std_msg *)&pMsg->PayloadPtr[0];
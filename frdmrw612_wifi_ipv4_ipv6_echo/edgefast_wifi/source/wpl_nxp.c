@@ -638,7 +638,13 @@ char *WPL_Scan(void)
     return NULL;
 }
 
-wpl_ret_t WPL_AddNetworkWithSecurity(const char *ssid, const char *password, const char *label, wpl_security_t security)
+static wpl_ret_t WPL_AddNetworkInternal(const char *ssid,
+                                        const char *password,
+                                        const char *label,
+                                        wpl_security_t security,
+                                        const uint8_t *bssid,
+                                        int channel,
+                                        const uint8_t *pmk)
 {
     wpl_ret_t status = WPLRET_SUCCESS;
     int ret;
@@ -688,6 +694,12 @@ wpl_ret_t WPL_AddNetworkWithSecurity(const char *ssid, const char *password, con
                     strncpy(sta_network.security.password, password, password_len);
                     sta_network.security.psk_len = (uint8_t)password_len;
                     strncpy(sta_network.security.psk, password, password_len);
+                    if (pmk != NULL)
+                    {
+                        /* Skip derivation of the PMK from the passphrase */
+                        (void)memcpy(sta_network.security.pmk, pmk, WLAN_PMK_LENGTH);
+                        sta_network.security.pmk_valid = true;
+                    }
                     break;
                 case WPL_SECURITY_WPA3_SAE:
                     sta_network.security.type = WLAN_SECURITY_WPA3_SAE;
@@ -711,6 +723,16 @@ wpl_ret_t WPL_AddNetworkWithSecurity(const char *ssid, const char *password, con
         sta_network.ip.ipv4.addr_type = ADDR_TYPE_DHCP;
         sta_network.ssid_specific     = 1;
 
+        /* Known BSSID and channel restrict the scan to single channel */
+        if (bssid != NULL)
+        {
+            (void)memcpy(sta_network.bssid, bssid, IEEEtypes_ADDRESS_SIZE);
+        }
+        if (channel > 0)
+        {
+            sta_network.channel = (unsigned int)channel;
+        }
+
         ret = wlan_add_network(&sta_network);
         if (ret != WM_SUCCESS)
         {
@@ -721,6 +743,17 @@ wpl_ret_t WPL_AddNetworkWithSecurity(const char *ssid, const char *password, con
     return status;
 }
 
+wpl_ret_t WPL_AddNetworkWithSecurity(const char *ssid, const char *password, const char *label, wpl_security_t security)
+{
+    return WPL_AddNetworkInternal(ssid, password, label, security, NULL, 0, NULL);
+}
+
+wpl_ret_t WPL_AddNetworkWithHints(
+    const char *ssid, const char *password, const char *label, const uint8_t *bssid, int channel, const uint8_t *pmk)
+{
+    return WPL_AddNetworkInternal(ssid, password, label, WPL_SECURITY_WILDCARD, bssid, channel, pmk);
+}
+
 wpl_ret_t WPL_AddNetwork(const char *ssid, const char *password, const char *label)
 {
     return WPL_AddNetworkWithSecurity(ssid, password, label, WPL_SECURITY_WILDCARD);
@@ -914,3 +947,42 @@ wpl_ret_t WPL_GetIP(char *ip, int client)
 
     return status;
 }
+
+wpl_ret_t WPL_GetNetworkHints(uint8_t *bssid, int *channel, uint8_t *pmk, bool *pmk_valid)
+{
+    wpl_ret_t status = WPLRET_SUCCESS;
+    int ret;
+    struct wlan_network sta_network;
+
+    if ((bssid == NULL) || (channel == NULL) || (pmk == NULL) || (pmk_valid == NULL))
+    {
+        status = WPLRET_BAD_PARAM;
+    }
+
+    if ((status == WPLRET_SUCCESS) && (s_wplStaConnected == false))
+    {
+        status = WPLRET_NOT_CONNECTED;
+    }
+
+    if (status == WPLRET_SUCCESS)
+    {
+        ret = wlan_get_current_network(&sta_network);
+        if (ret != WM_SUCCESS)
+        {
+            status = WPLRET_FAIL;
+        }
+    }
+
+    if (status == WPLRET_SUCCESS)
+    {
+        (void)memcpy(bssid, sta_network.bssid, IEEEtypes_ADDRESS_SIZE);
+        *channel   = (int)sta_network.channel;
+        *pmk_valid = sta_network.security.pmk_valid;
+        if (sta_network.security.pmk_valid)
+        {
+            (void)memcpy(pmk, sta_network.security.pmk, WLAN_PMK_LENGTH);
+        }
+    }
+
+    return status;
+}
@@ -13,6 +13,23 @@
 
 #define MFLASH_MAX_PATH_LEN 56
 
+/*
+ * Log mode: each save appends a new version of the file as a page aligned record with CRC instead of erasing and
+ * reprogramming the whole file area. Sectors are erased only when the writes wrap around the area, which is
+ * pre-allocated with enough spare room for this. Switching the mode formats the filesystem.
+ */
+#ifndef MFLASH_FILE_LOG
+#define MFLASH_FILE_LOG 0
+#endif
+
+/*
+ * Number of slots of the RAM hash index of the directory built at init, for constant time path lookup.
+ * Shall be power of 2 larger than the number of files, otherwise the directory is searched linearly. 0 disables the index.
+ */
+#ifndef MFLASH_DIR_INDEX_SIZE
+#define MFLASH_DIR_INDEX_SIZE 32
+#endif
+
 /*
  * Template for file record defines file path and size to be pre-allocated for that file.
  * The actual size of the file shall not exceed the size defined in the template.
@@ -162,6 +162,27 @@ uint32_t lwip_rand(void);
 #endif
 #endif
 
+// Checksum routines of the port, see chksum.c
+#if defined(LWIP_PORT_CHKSUM) && LWIP_PORT_CHKSUM
+#ifndef LWIP_CHKSUM
+uint16_t lwip_port_chksum(const void *dataptr, int len);
+#define LWIP_CHKSUM lwip_port_chksum
+#endif
+#if LWIP_CHECKSUM_ON_COPY && !defined(LWIP_CHKSUM_COPY)
+uint16_t lwip_port_chksum_copy(void *dst, const void *src, uint16_t len);
+#define LWIP_CHKSUM_COPY(dst, src, len) lwip_port_chksum_copy(dst, src, len)
+#endif
+#endif
+
+// Receive window limit of the port, see tcp_wnd.c
+#if defined(LWIP_PORT_TCP_WND_LIMIT) && LWIP_PORT_TCP_WND_LIMIT
+#ifndef LWIP_HOOK_TCP_RCV_WND_LIMIT
+struct tcp_pcb;
+uint32_t lwip_port_tcp_rcv_wnd_limit(const struct tcp_pcb *pcb);
+#define LWIP_HOOK_TCP_RCV_WND_LIMIT(pcb) lwip_port_tcp_rcv_wnd_limit(pcb)
+#endif
+#endif
+
 #include "arch/sys_arch.h"
 
 // fatal, print message and abandon execution.
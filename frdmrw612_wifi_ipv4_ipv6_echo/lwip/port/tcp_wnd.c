@@ -0,0 +1,78 @@
+/*
+ * Copyright 2025 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "lwip/opt.h"
+
+/*
+ * Build time consistency checks of the pbuf pool against the stack configuration.
+ * Received frames are held in PBUF_POOL buffers until the application reads them,
+ * so the pool must be able to take everything the stack lets the remote hosts send.
+ */
+#if !defined(LWIP_DISABLE_PBUF_POOL_SIZE_SANITY_CHECKS) || !LWIP_DISABLE_PBUF_POOL_SIZE_SANITY_CHECKS
+#if LWIP_IPV4 && LWIP_IPV6 && IP_REASSEMBLY && LWIP_IPV6_REASS && PBUF_POOL_SIZE && \
+    (PBUF_POOL_SIZE <= (2 * IP_REASS_MAX_PBUFS))
+#error "PBUF_POOL_SIZE must be larger than 2 * IP_REASS_MAX_PBUFS, otherwise pending reassembly can take all the pool."
+#endif
+#if LWIP_TCP && PBUF_POOL_SIZE && !(defined(LWIP_PORT_TCP_WND_LIMIT) && LWIP_PORT_TCP_WND_LIMIT) && \
+    ((MEMP_NUM_TCP_PCB * TCP_WND) > (PBUF_POOL_SIZE * TCP_MSS))
+#error "Receive windows of all TCP PCBs exceed PBUF_POOL_SIZE, set LWIP_PORT_TCP_WND_LIMIT to 1 or enlarge the pool."
+#endif
+#endif /* LWIP_DISABLE_PBUF_POOL_SIZE_SANITY_CHECKS */
+
+#if LWIP_TCP && defined(LWIP_PORT_TCP_WND_LIMIT) && LWIP_PORT_TCP_WND_LIMIT
+
+#if !MEMP_STATS
+#error "LWIP_PORT_TCP_WND_LIMIT requires MEMP_STATS"
+#endif
+
+#include "lwip/memp.h"
+#include "lwip/stats.h"
+#include "lwip/tcp.h"
+
+/* Lowest window limit, at least the opening which makes tcp_recved() send a window update */
+#define LWIP_PORT_TCP_WND_LIMIT_MIN LWIP_MAX((u32_t)TCP_WND_UPDATE_THRESHOLD, 2U * TCP_MSS)
+
+/*
+ * Each received segment takes one PBUF_POOL buffer until the application reads it.
+ * The free buffers are shared equally among the allocated TCP PCBs and a PCB does not
+ * announce more window than its share, so a few fast senders cannot take the whole pool
+ * and make the Wi-Fi driver drop frames of the others. When the pool is idle the share
+ * is larger than TCP_WND and the window is not limited at all.
+ *
+ * The window is never limited below TCP_WND_UPDATE_THRESHOLD (nor 2 * TCP_MSS). When the
+ * remote host has filled the window, tcp_recved() sends the update reopening it only once
+ * the opening reaches the threshold. A closed window receives no segments, so with a lower
+ * limit the connection would wait for the persist timer of the remote host.
+ */
+u32_t lwip_port_tcp_rcv_wnd_limit(const struct tcp_pcb *pcb)
+{
+    u32_t pool_free = (u32_t)MEMP_STATS_GET(avail, MEMP_PBUF_POOL) - MEMP_STATS_GET(used, MEMP_PBUF_POOL);
+    u32_t pcbs      = MEMP_STATS_GET(used, MEMP_TCP_PCB);
+    u32_t limit;
+
+    if (pcbs == 0U)
+    {
+        pcbs = 1U;
+    }
+
+    limit = (pool_free / pcbs) * TCP_MSS;
+    if (limit < LWIP_PORT_TCP_WND_LIMIT_MIN)
+    {
+        limit = LWIP_PORT_TCP_WND_LIMIT_MIN;
+    }
+
+    if (limit < pcb->rcv_wnd)
+    {
+        LWIP_DEBUGF(TCP_WND_DEBUG, ("tcp_rcv_wnd_limit: %" U32_F " free pool buffers for %" U32_F " PCBs, window %" U32_F
+                                    " limited to %" U32_F "\n",
+                                    pool_free, pcbs, (u32_t)pcb->rcv_wnd, limit));
+    }
+
+    return limit;
+}
+
+#endif /* LWIP_PORT_TCP_WND_LIMIT */
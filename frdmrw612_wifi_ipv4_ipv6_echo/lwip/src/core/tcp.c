@@ -185,6 +185,12 @@ struct tcp_pcb **const tcp_pcb_lists[] = {&tcp_listen_pcbs.pcbs, &tcp_bound_pcbs
 
 u8_t tcp_active_pcbs_changed;
 
+#if LWIP_TCP_PCB_HASH_SIZE
+/** Buckets of tcp_active_pcbs, chained by hash_next, so that tcp_input() does not
+ * have to walk all active PCBs to find the one an incoming segment belongs to */
+struct tcp_pcb *tcp_active_pcbs_hash[LWIP_TCP_PCB_HASH_SIZE];
+#endif /* LWIP_TCP_PCB_HASH_SIZE */
+
 /** Timer counter to handle calling slow-timer from tcp_tmr() */
 static u8_t tcp_timer;
 static u8_t tcp_timer_ctr;
@@ -935,13 +941,24 @@ u32_t
 tcp_update_rcv_ann_wnd(struct tcp_pcb *pcb)
 {
   u32_t new_right_edge;
+  tcpwnd_size_t rcv_wnd;
 
   LWIP_ASSERT("tcp_update_rcv_ann_wnd: invalid pcb", pcb != NULL);
-  new_right_edge = pcb->rcv_nxt + pcb->rcv_wnd;
+  rcv_wnd = pcb->rcv_wnd;
+#ifdef LWIP_HOOK_TCP_RCV_WND_LIMIT
+  {
+    /* the limit only holds back opening the window, announced right edge is never moved back */
+    u32_t rcv_wnd_limit = LWIP_HOOK_TCP_RCV_WND_LIMIT(pcb);
+    if (rcv_wnd_limit < rcv_wnd) {
+      rcv_wnd = (tcpwnd_size_t)rcv_wnd_limit;
+    }
+  }
+#endif /* LWIP_HOOK_TCP_RCV_WND_LIMIT */
+  new_right_edge = pcb->rcv_nxt + rcv_wnd;
 
   if (TCP_SEQ_GEQ(new_right_edge, pcb->rcv_ann_right_edge + LWIP_MIN((TCP_WND / 2), pcb->mss))) {
     /* we can advertise more window */
-    pcb->rcv_ann_wnd = pcb->rcv_wnd;
+    pcb->rcv_ann_wnd = rcv_wnd;
     return new_right_edge - pcb->rcv_ann_right_edge;
   } else {
     if (TCP_SEQ_GT(pcb->rcv_nxt, pcb->rcv_ann_right_edge)) {
@@ -1400,6 +1417,7 @@ tcp_slowtmr_start:
       enum tcp_state last_state;
       tcp_pcb_purge(pcb);
       /* Remove PCB from tcp_active_pcbs list. */
+      TCP_ACTIVE_HASH_RMV(pcb);
       if (prev != NULL) {
         LWIP_ASSERT("tcp_slowtmr: middle tcp != tcp_active_pcbs", pcb != tcp_active_pcbs);
         prev->next = pcb->next;
@@ -2208,6 +2226,68 @@ tcp_pcb_purge(struct tcp_pcb *pcb)
   }
 }
 
+#if LWIP_TCP_PCB_HASH_SIZE
+static u32_t
+tcp_active_pcbs_hash_ip(const ip_addr_t *ip)
+{
+#if LWIP_IPV6
+  if (IP_IS_V6(ip)) {
+    /* the interface identifier differs most between hosts */
+    return ip_2_ip6(ip)->addr[3];
+  }
+#endif /* LWIP_IPV6 */
+#if LWIP_IPV4
+  return ip4_addr_get_u32(ip_2_ip4(ip));
+#else /* LWIP_IPV4 */
+  return 0;
+#endif /* LWIP_IPV4 */
+}
+
+/**
+ * Returns the bucket of tcp_active_pcbs_hash holding the active PCBs that
+ * may match the given ports and remote address.
+ */
+struct tcp_pcb **
+tcp_active_pcbs_bucket(u16_t local_port, u16_t remote_port, const ip_addr_t *remote_ip)
+{
+  u32_t h = tcp_active_pcbs_hash_ip(remote_ip) ^ ((u32_t)local_port << 16) ^ remote_port;
+
+  h ^= h >> 16;
+  h ^= h >> 8;
+  return &tcp_active_pcbs_hash[h & (LWIP_TCP_PCB_HASH_SIZE - 1)];
+}
+
+/**
+ * Adds a PCB being registered in tcp_active_pcbs to its bucket.
+ * The ports and the remote address must not change until it is removed.
+ */
+void
+tcp_active_pcbs_hash_add(struct tcp_pcb *pcb)
+{
+  struct tcp_pcb **bucket = tcp_active_pcbs_bucket(pcb->local_port, pcb->remote_port, &pcb->remote_ip);
+
+  pcb->hash_next = *bucket;
+  *bucket = pcb;
+}
+
+/**
+ * Removes a PCB from its bucket, does nothing if it is not there.
+ */
+void
+tcp_active_pcbs_hash_remove(struct tcp_pcb *pcb)
+{
+  struct tcp_pcb **link = tcp_active_pcbs_bucket(pcb->local_port, pcb->remote_port, &pcb->remote_ip);
+
+  for (; *link != NULL; link = &(*link)->hash_next) {
+    if (*link == pcb) {
+      *link = pcb->hash_next;
+      break;
+    }
+  }
+  pcb->hash_next = NULL;
+}
+#endif /* LWIP_TCP_PCB_HASH_SIZE */
+
 /**
  * Purges the PCB and removes it from a PCB list. Any delayed ACKs are sent first.
  *
@@ -2220,6 +2300,11 @@ tcp_pcb_remove(struct tcp_pcb **pcblist, struct tcp_pcb *pcb)
   LWIP_ASSERT("tcp_pcb_remove: invalid pcb", pcb != NULL);
   LWIP_ASSERT("tcp_pcb_remove: invalid pcblist", pcblist != NULL);
 
+#if LWIP_TCP_PCB_HASH_SIZE
+  if (pcblist == &tcp_active_pcbs) {
+    TCP_ACTIVE_HASH_RMV(pcb);
+  }
+#endif /* LWIP_TCP_PCB_HASH_SIZE */
   TCP_RMV(pcblist, pcb);
 
   tcp_pcb_purge(pcb);
@@ -120,11 +120,213 @@ const int lwip_num_cyclic_timers = LWIP_ARRAYSIZE(lwip_cyclic_timers);
 
 #if LWIP_TIMERS && !LWIP_TIMERS_CUSTOM
 
+static u32_t current_timeout_due_time;
+
+#if LWIP_TIMERS_WHEEL
+/*
+ * Hierarchical timer wheel: level 0 has a slot for each of the next
+ * SYS_TIMEO_WHEEL_SLOTS milliseconds, the slots of each next level are
+ * SYS_TIMEO_WHEEL_SLOTS times longer. The timeouts of an upper level slot are
+ * moved down (cascaded) when the wheel reaches the start of that slot, so each
+ * timeout is moved at most SYS_TIMEO_WHEEL_LEVELS - 1 times.
+ * Level 0 slots are kept in the order of the timeout list: by due time, then in
+ * the order the timeouts were added. Upper level slots are not ordered.
+ * Timeouts added when already due (before timeo_wheel_time) wait at the head of
+ * the level 0 slot of timeo_wheel_time. sys_check_timeouts() calls them as soon
+ * as they are due, as the list does, not only when the wheel reaches that tick.
+ */
+#define SYS_TIMEO_WHEEL_BITS    6
+#define SYS_TIMEO_WHEEL_SLOTS   (1UL << SYS_TIMEO_WHEEL_BITS)
+#define SYS_TIMEO_WHEEL_MASK    (SYS_TIMEO_WHEEL_SLOTS - 1)
+/* 5 levels cover 2^30 ms, the longest timeout accepted by sys_timeout() */
+#define SYS_TIMEO_WHEEL_LEVELS  5
+#define SYS_TIMEO_WHEEL_SPAN    (1UL << (SYS_TIMEO_WHEEL_LEVELS * SYS_TIMEO_WHEEL_BITS))
+/* slot of timeouts taken out of the wheel by sys_check_timeouts() */
+#define SYS_TIMEO_SLOT_NONE     0xFFFF
+/* buckets of the sys_untimeout() lookup, about two timeouts each when the pool is used up */
+#define SYS_TIMEO_HASH_SIZE     ((MEMP_NUM_SYS_TIMEOUT / 2) + 1)
+
+static struct sys_timeo *timeo_wheel[SYS_TIMEO_WHEEL_LEVELS * SYS_TIMEO_WHEEL_SLOTS];
+static u16_t timeo_wheel_count[SYS_TIMEO_WHEEL_LEVELS];
+/* The next tick to process: earlier ticks have been processed, the timeouts
+   of an upper level slot starting at this tick have not been cascaded yet */
+static u32_t timeo_wheel_time;
+/* The timeouts by handler and arg, for sys_untimeout() */
+static struct sys_timeo *timeo_hash[SYS_TIMEO_HASH_SIZE];
+/* Sequence number of the next timeout added */
+static u32_t timeo_seq;
+
+/* Returns nonzero if timeout a comes before timeout b in the timeout list */
+static int
+timeo_before(const struct sys_timeo *a, const struct sys_timeo *b)
+{
+  if (a->time != b->time) {
+    return TIME_LESS_THAN(a->time, b->time);
+  }
+  return (s32_t)(a->seq - b->seq) < 0;
+}
+
+static struct sys_timeo **
+timeo_hash_bucket(sys_timeout_handler handler, void *arg)
+{
+  u32_t h = (u32_t)(mem_ptr_t)handler ^ (u32_t)(mem_ptr_t)arg;
+
+  h ^= (h >> 5) ^ (h >> 13);
+  return &timeo_hash[h % SYS_TIMEO_HASH_SIZE];
+}
+
+static void
+timeo_hash_remove(struct sys_timeo *timeout)
+{
+  struct sys_timeo **link;
+
+  for (link = timeo_hash_bucket(timeout->h, timeout->arg); *link != NULL; link = &(*link)->hash_next) {
+    if (*link == timeout) {
+      *link = timeout->hash_next;
+      return;
+    }
+  }
+  LWIP_ASSERT("timeout not in hash", 0);
+}
+
+/* Inserts a timeout at a link (slot head or previous 'next') */
+static void
+timeo_link(struct sys_timeo **link, struct sys_timeo *timeout)
+{
+  timeout->next = *link;
+  if (timeout->next != NULL) {
+    timeout->next->pprev = &timeout->next;
+  }
+  timeout->pprev = link;
+  *link = timeout;
+}
+
+/* Removes a timeout from its wheel slot, or from the list of timeouts being called */
+static void
+timeo_unlink(struct sys_timeo *timeout)
+{
+  *timeout->pprev = timeout->next;
+  if (timeout->next != NULL) {
+    timeout->next->pprev = timeout->pprev;
+  }
+  if (timeout->slot != SYS_TIMEO_SLOT_NONE) {
+    timeo_wheel_count[timeout->slot / SYS_TIMEO_WHEEL_SLOTS]--;
+  }
+}
+
+/* Puts a timeout to the slot where the wheel reaches it in time */
+static void
+timeo_wheel_add(struct sys_timeo *timeout)
+{
+  u32_t delta = (u32_t)(timeout->time - timeo_wheel_time);
+  u32_t level = 0;
+  u32_t slot;
+  struct sys_timeo **link;
+
+  if (TIME_LESS_THAN(timeout->time, timeo_wheel_time)) {
+    /* already due, ahead of the timeouts due at the next tick processed */
+    delta = 0;
+  } else if (delta >= SYS_TIMEO_WHEEL_SPAN) {
+    /* beyond the wheel, placed again when its slot is cascaded */
+    delta = SYS_TIMEO_WHEEL_SPAN - 1;
+  }
+  while (delta >= (1UL << ((level + 1) * SYS_TIMEO_WHEEL_BITS))) {
+    level++;
+  }
+  slot = (level * SYS_TIMEO_WHEEL_SLOTS) +
+         (((timeo_wheel_time + delta) >> (level * SYS_TIMEO_WHEEL_BITS)) & SYS_TIMEO_WHEEL_MASK);
+
+  link = &timeo_wheel[slot];
+  if (level == 0) {
+    /* holds the timeouts due at this tick and the overdue ones, called in list order */
+    while ((*link != NULL) && !timeo_before(timeout, *link)) {
+      link = &(*link)->next;
+    }
+  }
+  timeout->slot = (u16_t)slot;
+  timeo_link(link, timeout);
+  timeo_wheel_count[level]++;
+}
+
+static u8_t
+timeo_wheel_empty(void)
+{
+  u32_t level;
+
+  for (level = 0; level < SYS_TIMEO_WHEEL_LEVELS; level++) {
+    if (timeo_wheel_count[level] != 0) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/* Returns the first used slot of a level in the order the wheel reaches them,
+   SYS_TIMEO_SLOT_NONE if the level is empty. Sets *start to the tick the wheel reaches it. */
+static u32_t
+timeo_wheel_first_slot(u32_t level, u32_t *start)
+{
+  u32_t shift = level * SYS_TIMEO_WHEEL_BITS;
+  u32_t next;
+  u32_t i;
+
+  if (timeo_wheel_count[level] == 0) {
+    return SYS_TIMEO_SLOT_NONE;
+  }
+  /* index of the first slot of this level starting at or after timeo_wheel_time */
+  next = (timeo_wheel_time >> shift) + (((timeo_wheel_time & ((1UL << shift) - 1)) != 0) ? 1 : 0);
+  for (i = 0; i < SYS_TIMEO_WHEEL_SLOTS; i++) {
+    if (timeo_wheel[(level * SYS_TIMEO_WHEEL_SLOTS) + ((next + i) & SYS_TIMEO_WHEEL_MASK)] != NULL) {
+      *start = (u32_t)((next + i) << shift);
+      return (level * SYS_TIMEO_WHEEL_SLOTS) + ((next + i) & SYS_TIMEO_WHEEL_MASK);
+    }
+  }
+  LWIP_ASSERT("timeo_wheel_count inconsistent", 0);
+  return SYS_TIMEO_SLOT_NONE;
+}
+
+/* Returns the time from timeo_wheel_time to the next tick with a level 0 slot to call or
+   an upper level slot to cascade, SYS_TIMEOUTS_SLEEPTIME_INFINITE if the wheel is empty */
+static u32_t
+timeo_wheel_next_tick(void)
+{
+  u32_t ret = SYS_TIMEOUTS_SLEEPTIME_INFINITE;
+  u32_t level;
+  u32_t start;
+
+  for (level = 0; level < SYS_TIMEO_WHEEL_LEVELS; level++) {
+    if ((timeo_wheel_first_slot(level, &start) != SYS_TIMEO_SLOT_NONE) &&
+        ((u32_t)(start - timeo_wheel_time) < ret)) {
+      ret = (u32_t)(start - timeo_wheel_time);
+    }
+  }
+  return ret;
+}
+
+/* Cascades the upper level slots starting at timeo_wheel_time */
+static void
+timeo_wheel_cascade(void)
+{
+  u32_t level;
+  u32_t slot;
+
+  for (level = 1; level < SYS_TIMEO_WHEEL_LEVELS; level++) {
+    if ((timeo_wheel_time & ((1UL << (level * SYS_TIMEO_WHEEL_BITS)) - 1)) != 0) {
+      break;
+    }
+    slot = (level * SYS_TIMEO_WHEEL_SLOTS) +
+           ((timeo_wheel_time >> (level * SYS_TIMEO_WHEEL_BITS)) & SYS_TIMEO_WHEEL_MASK);
+    while (timeo_wheel[slot] != NULL) {
+      struct sys_timeo *t = timeo_wheel[slot];
+      timeo_unlink(t);
+      timeo_wheel_add(t);
+    }
+  }
+}
+#else /* LWIP_TIMERS_WHEEL */
 /** The one and only timeout list */
 static struct sys_timeo *next_timeout;
 
-static u32_t current_timeout_due_time;
-
 #if LWIP_TESTMODE
 struct sys_timeo**
 sys_timeouts_get_next_timeout(void)
@@ -132,6 +334,7 @@ sys_timeouts_get_next_timeout(void)
   return &next_timeout;
 }
 #endif
+#endif /* LWIP_TIMERS_WHEEL */
 
 #if LWIP_TCP
 /** global variable that shows if the tcp timer is currently scheduled or not */
@@ -185,7 +388,12 @@ sys_timeout_abs(u32_t abs_time, sys_timeout_handler handler, void *arg, const ch
 sys_timeout_abs(u32_t abs_time, sys_timeout_handler handler, void *arg)
 #endif
 {
-  struct sys_timeo *timeout, *t;
+  struct sys_timeo *timeout;
+#if LWIP_TIMERS_WHEEL
+  struct sys_timeo **bucket;
+#else /* LWIP_TIMERS_WHEEL */
+  struct sys_timeo *t;
+#endif /* LWIP_TIMERS_WHEEL */
 
   timeout = (struct sys_timeo *)memp_malloc(MEMP_SYS_TIMEOUT);
   if (timeout == NULL) {
@@ -204,6 +412,20 @@ sys_timeout_abs(u32_t abs_time, sys_timeout_handler handler, void *arg)
                              (void *)timeout, abs_time, handler_name, (void *)arg));
 #endif /* LWIP_DEBUG_TIMERNAMES */
 
+#if LWIP_TIMERS_WHEEL
+  if (timeo_wheel_empty()) {
+    /* skip the ticks passed since the wheel became empty */
+    u32_t now = sys_now();
+    if (TIME_LESS_THAN(timeo_wheel_time, now)) {
+      timeo_wheel_time = now;
+    }
+  }
+  timeout->seq = timeo_seq++;
+  timeo_wheel_add(timeout);
+  bucket = timeo_hash_bucket(handler, arg);
+  timeout->hash_next = *bucket;
+  *bucket = timeout;
+#else /* LWIP_TIMERS_WHEEL */
   if (next_timeout == NULL) {
     next_timeout = timeout;
     return;
@@ -220,6 +442,7 @@ sys_timeout_abs(u32_t abs_time, sys_timeout_handler handler, void *arg)
       }
     }
   }
+#endif /* LWIP_TIMERS_WHEEL */
 }
 
 /**
@@ -266,6 +489,9 @@ lwip_cyclic_timer(void *arg)
 void sys_timeouts_init(void)
 {
   size_t i;
+#if LWIP_TIMERS_WHEEL
+  timeo_wheel_time = sys_now();
+#endif /* LWIP_TIMERS_WHEEL */
   /* tcp_tmr() at index 0 is started on demand */
   for (i = (LWIP_TCP ? 1 : 0); i < LWIP_ARRAYSIZE(lwip_cyclic_timers); i++) {
     /* we have to cast via size_t to get rid of const warning
@@ -327,6 +553,25 @@ sys_timeout(u32_t msecs, sys_timeout_handler handler, void *arg)
 void
 sys_untimeout(sys_timeout_handler handler, void *arg)
 {
+#if LWIP_TIMERS_WHEEL
+  struct sys_timeo *match, *t;
+
+  LWIP_ASSERT_CORE_LOCKED();
+
+  /* the first matching entry of the list */
+  match = NULL;
+  for (t = *timeo_hash_bucket(handler, arg); t != NULL; t = t->hash_next) {
+    if ((t->h == handler) && (t->arg == arg) &&
+        ((match == NULL) || timeo_before(t, match))) {
+      match = t;
+    }
+  }
+  if (match != NULL) {
+    timeo_unlink(match);
+    timeo_hash_remove(match);
+    memp_free(MEMP_SYS_TIMEOUT, match);
+  }
+#else /* LWIP_TIMERS_WHEEL */
   struct sys_timeo *prev_t, *t;
 
   LWIP_ASSERT_CORE_LOCKED();
@@ -349,6 +594,7 @@ sys_untimeout(sys_timeout_handler handler, void *arg)
     }
   }
   return;
+#endif /* LWIP_TIMERS_WHEEL */
 }
 
 /**
@@ -363,12 +609,91 @@ void
 sys_check_timeouts(void)
 {
   u32_t now;
+#if LWIP_TIMERS_WHEEL
+  struct sys_timeo *called;
+  struct sys_timeo **called_tail;
+  u32_t next;
+#endif /* LWIP_TIMERS_WHEEL */
 
   LWIP_ASSERT_CORE_LOCKED();
 
   /* Process only timers expired at the start of the function. */
   now = sys_now();
 
+#if LWIP_TIMERS_WHEEL
+  PBUF_CHECK_FREE_OOSEQ();
+
+  do {
+    struct sys_timeo *tmptimeout;
+    sys_timeout_handler handler;
+    void *arg;
+
+    /* Take out the timeouts to call keeping their order, the handlers
+       may add timeouts or remove them */
+    called = NULL;
+    called_tail = &called;
+
+    if (!TIME_LESS_THAN(now, timeo_wheel_time)) {
+      next = timeo_wheel_next_tick();
+      if ((next == SYS_TIMEOUTS_SLEEPTIME_INFINITE) || TIME_LESS_THAN(now, timeo_wheel_time + next)) {
+        /* nothing to call or cascade up to now */
+        timeo_wheel_time = now + 1;
+      } else {
+        timeo_wheel_time += next;
+        timeo_wheel_cascade();
+
+        /* all timeouts of this tick */
+        while ((tmptimeout = timeo_wheel[timeo_wheel_time & SYS_TIMEO_WHEEL_MASK]) != NULL) {
+          timeo_unlink(tmptimeout);
+          tmptimeout->slot = SYS_TIMEO_SLOT_NONE;
+          timeo_link(called_tail, tmptimeout);
+          called_tail = &tmptimeout->next;
+        }
+        timeo_wheel_time++;
+        if (called == NULL) {
+          /* the tick only cascaded upper level slots */
+          continue;
+        }
+      }
+    }
+
+    if (called == NULL) {
+      /* Up to now the wheel is done, but timeouts added when already due (e.g.
+         sys_timeout(0) in the millisecond of the last tick) wait ahead of the
+         next tick. The list calls them now. */
+      while (((tmptimeout = timeo_wheel[timeo_wheel_time & SYS_TIMEO_WHEEL_MASK]) != NULL) &&
+             !TIME_LESS_THAN(now, tmptimeout->time)) {
+        timeo_unlink(tmptimeout);
+        tmptimeout->slot = SYS_TIMEO_SLOT_NONE;
+        timeo_link(called_tail, tmptimeout);
+        called_tail = &tmptimeout->next;
+      }
+      if (called == NULL) {
+        return;
+      }
+    }
+
+    while ((tmptimeout = called) != NULL) {
+      timeo_unlink(tmptimeout);
+      timeo_hash_remove(tmptimeout);
+      handler = tmptimeout->h;
+      arg = tmptimeout->arg;
+      current_timeout_due_time = tmptimeout->time;
+#if LWIP_DEBUG_TIMERNAMES
+      if (handler != NULL) {
+        LWIP_DEBUGF(TIMERS_DEBUG, ("sct calling h=%s t=%"U32_F" arg=%p\n",
+                                   tmptimeout->handler_name, sys_now() - tmptimeout->time, arg));
+      }
+#endif /* LWIP_DEBUG_TIMERNAMES */
+      memp_free(MEMP_SYS_TIMEOUT, tmptimeout);
+      if (handler != NULL) {
+        handler(arg);
+      }
+      LWIP_TCPIP_THREAD_ALIVE();
+      PBUF_CHECK_FREE_OOSEQ();
+    }
+  } while (1);
+#else /* LWIP_TIMERS_WHEEL */
   do {
     struct sys_timeo *tmptimeout;
     sys_timeout_handler handler;
@@ -404,6 +729,7 @@ sys_check_timeouts(void)
 
     /* Repeat until all expired timers have been called */
   } while (1);
+#endif /* LWIP_TIMERS_WHEEL */
 }
 
 /** Rebase the timeout times to the current time.
@@ -417,6 +743,34 @@ sys_restart_timeouts(void)
   u32_t now;
   u32_t base;
   struct sys_timeo *t;
+#if LWIP_TIMERS_WHEEL
+  struct sys_timeo *all = NULL;
+  u32_t slot;
+
+  /* take all timeouts out of the wheel and add them again with the new times */
+  for (slot = 0; slot < (SYS_TIMEO_WHEEL_LEVELS * SYS_TIMEO_WHEEL_SLOTS); slot++) {
+    while ((t = timeo_wheel[slot]) != NULL) {
+      timeo_unlink(t);
+      if ((all == NULL) || TIME_LESS_THAN(t->time, base)) {
+        base = t->time;
+      }
+      t->next = all;
+      all = t;
+    }
+  }
+  if (all == NULL) {
+    return;
+  }
+
+  now = sys_now();
+  timeo_wheel_time = now;
+
+  while ((t = all) != NULL) {
+    all = t->next;
+    t->time = (t->time - base) + now;
+    timeo_wheel_add(t);
+  }
+#else /* LWIP_TIMERS_WHEEL */
 
   if (next_timeout == NULL) {
     return;
@@ -428,6 +782,7 @@ sys_restart_timeouts(void)
   for (t = next_timeout; t != NULL; t = t->next) {
     t->time = (t->time - base) + now;
   }
+#endif /* LWIP_TIMERS_WHEEL */
 }
 
 /** Return the time left before the next timeout is due. If no timeouts are
@@ -437,17 +792,34 @@ u32_t
 sys_timeouts_sleeptime(void)
 {
   u32_t now;
+  u32_t first;
 
   LWIP_ASSERT_CORE_LOCKED();
 
+#if LWIP_TIMERS_WHEEL
+  /* Timeouts of an upper level are only known to be due in their slot, so this
+     may be the time when they are moved down to a finer level, which is earlier. */
+  first = timeo_wheel_next_tick();
+  if (first == SYS_TIMEOUTS_SLEEPTIME_INFINITE) {
+    return SYS_TIMEOUTS_SLEEPTIME_INFINITE;
+  }
+  first += timeo_wheel_time;
+  /* timeouts added when already due are at the head of the slot of timeo_wheel_time */
+  if ((timeo_wheel[timeo_wheel_time & SYS_TIMEO_WHEEL_MASK] != NULL) &&
+      TIME_LESS_THAN(timeo_wheel[timeo_wheel_time & SYS_TIMEO_WHEEL_MASK]->time, first)) {
+    first = timeo_wheel[timeo_wheel_time & SYS_TIMEO_WHEEL_MASK]->time;
+  }
+#else /* LWIP_TIMERS_WHEEL */
   if (next_timeout == NULL) {
     return SYS_TIMEOUTS_SLEEPTIME_INFINITE;
   }
+  first = next_timeout->time;
+#endif /* LWIP_TIMERS_WHEEL */
   now = sys_now();
-  if (TIME_LESS_THAN(next_timeout->time, now)) {
+  if (TIME_LESS_THAN(first, now)) {
     return 0;
   } else {
-    u32_t ret = (u32_t)(next_timeout->time - now);
+    u32_t ret = (u32_t)(first - now);
     LWIP_ASSERT("invalid sleeptime", ret <= LWIP_MAX_TIMEOUT);
     return ret;
   }
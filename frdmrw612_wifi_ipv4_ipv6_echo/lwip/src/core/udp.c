@@ -80,6 +80,17 @@ static u16_t udp_port = UDP_LOCAL_PORT_RANGE_START;
 /* exported in udp.h (was static) */
 struct udp_pcb *udp_pcbs;
 
+/** The PCBs that may be bound to a local port: its bucket chain or the whole list */
+#if LWIP_UDP_PCB_HASH_SIZE
+/* The PCBs of udp_pcbs by local port, chained by hash_next */
+static struct udp_pcb *udp_pcbs_hash[LWIP_UDP_PCB_HASH_SIZE];
+#define UDP_PORT_PCBS(port) udp_pcbs_hash[((port) ^ ((port) >> 8)) & (LWIP_UDP_PCB_HASH_SIZE - 1)]
+#define UDP_PORT_NEXT(pcb)  ((pcb)->hash_next)
+#else /* LWIP_UDP_PCB_HASH_SIZE */
+#define UDP_PORT_PCBS(port) udp_pcbs
+#define UDP_PORT_NEXT(pcb)  ((pcb)->next)
+#endif /* LWIP_UDP_PCB_HASH_SIZE */
+
 /**
  * Initialize this module.
  */
@@ -107,7 +118,7 @@ again:
     udp_port = UDP_LOCAL_PORT_RANGE_START;
   }
   /* Check all PCBs. */
-  for (pcb = udp_pcbs; pcb != NULL; pcb = pcb->next) {
+  for (pcb = UDP_PORT_PCBS(udp_port); pcb != NULL; pcb = UDP_PORT_NEXT(pcb)) {
     if (pcb->local_port == udp_port) {
       if (++n > (UDP_LOCAL_PORT_RANGE_END - UDP_LOCAL_PORT_RANGE_START)) {
         return 0;
@@ -118,6 +129,31 @@ again:
   return udp_port;
 }
 
+#if LWIP_UDP_PCB_HASH_SIZE
+/** Adds a PCB of udp_pcbs to the bucket of its local port */
+static void
+udp_hash_add(struct udp_pcb *pcb)
+{
+  pcb->hash_next = UDP_PORT_PCBS(pcb->local_port);
+  UDP_PORT_PCBS(pcb->local_port) = pcb;
+}
+
+/** Removes a PCB from the bucket of its local port, does nothing if it is not there */
+static void
+udp_hash_remove(struct udp_pcb *pcb)
+{
+  struct udp_pcb **link;
+
+  for (link = &UDP_PORT_PCBS(pcb->local_port); *link != NULL; link = &(*link)->hash_next) {
+    if (*link == pcb) {
+      *link = pcb->hash_next;
+      break;
+    }
+  }
+  pcb->hash_next = NULL;
+}
+#endif /* LWIP_UDP_PCB_HASH_SIZE */
+
 /** Common code to see if the current input packet matches the pcb
  * (current input packet is accessed via ip(4/6)_current_* macros)
  *
@@ -250,7 +286,7 @@ udp_input(struct pbuf *p, struct netif *inp)
    * 'Perfect match' pcbs (connected to the remote port & ip address) are
    * preferred. If no perfect match is found, the first unconnected pcb that
    * matches the local port and ip address gets the datagram. */
-  for (pcb = udp_pcbs; pcb != NULL; pcb = pcb->next) {
+  for (pcb = UDP_PORT_PCBS(dest); pcb != NULL; pcb = UDP_PORT_NEXT(pcb)) {
     /* print the PCB local and remote address */
     LWIP_DEBUGF(UDP_DEBUG, ("pcb ("));
     ip_addr_debug_print_val(UDP_DEBUG, pcb->local_ip);
@@ -291,11 +327,11 @@ udp_input(struct pbuf *p, struct netif *inp)
            ip_addr_eq(&pcb->remote_ip, ip_current_src_addr()))) {
         /* the first fully matching PCB */
         if (prev != NULL) {
-          /* move the pcb to the front of udp_pcbs so that is
-             found faster next time */
-          prev->next = pcb->next;
-          pcb->next = udp_pcbs;
-          udp_pcbs = pcb;
+          /* move the pcb to the front of udp_pcbs (or of its bucket)
+             so that is found faster next time */
+          UDP_PORT_NEXT(prev) = UDP_PORT_NEXT(pcb);
+          UDP_PORT_NEXT(pcb) = UDP_PORT_PCBS(dest);
+          UDP_PORT_PCBS(dest) = pcb;
         } else {
           UDP_STATS_INC(udp.cachehit);
         }
@@ -380,7 +416,7 @@ udp_input(struct pbuf *p, struct netif *inp)
         /* pass broadcast- or multicast packets to all multicast pcbs
            if SOF_REUSEADDR is set on the first match */
         struct udp_pcb *mpcb;
-        for (mpcb = udp_pcbs; mpcb != NULL; mpcb = mpcb->next) {
+        for (mpcb = UDP_PORT_PCBS(dest); mpcb != NULL; mpcb = UDP_PORT_NEXT(mpcb)) {
           if (mpcb != pcb) {
             /* compare PCB local addr+port to UDP destination addr+port */
             if ((mpcb->local_port == dest) &&
@@ -985,7 +1021,7 @@ udp_bind(struct udp_pcb *pcb, const ip_addr_t *ipaddr, u16_t port)
       return ERR_USE;
     }
   } else {
-    for (ipcb = udp_pcbs; ipcb != NULL; ipcb = ipcb->next) {
+    for (ipcb = UDP_PORT_PCBS(port); ipcb != NULL; ipcb = UDP_PORT_NEXT(ipcb)) {
       if (pcb != ipcb) {
         /* By default, we don't allow to bind to a port that any other udp
            PCB is already bound to, unless *all* PCBs with that port have the
@@ -1016,6 +1052,12 @@ udp_bind(struct udp_pcb *pcb, const ip_addr_t *ipaddr, u16_t port)
 
   ip_addr_set_ipaddr(&pcb->local_ip, ipaddr);
 
+#if LWIP_UDP_PCB_HASH_SIZE
+  if (rebind) {
+    /* still in the bucket of the old port */
+    udp_hash_remove(pcb);
+  }
+#endif /* LWIP_UDP_PCB_HASH_SIZE */
   pcb->local_port = port;
   mib2_udp_bind(pcb);
   /* pcb not active yet? */
@@ -1024,6 +1066,9 @@ udp_bind(struct udp_pcb *pcb, const ip_addr_t *ipaddr, u16_t port)
     pcb->next = udp_pcbs;
     udp_pcbs = pcb;
   }
+#if LWIP_UDP_PCB_HASH_SIZE
+  udp_hash_add(pcb);
+#endif /* LWIP_UDP_PCB_HASH_SIZE */
   LWIP_DEBUGF(UDP_DEBUG | LWIP_DBG_TRACE | LWIP_DBG_STATE, ("udp_bind: bound to "));
   ip_addr_debug_print_val(UDP_DEBUG | LWIP_DBG_TRACE | LWIP_DBG_STATE, pcb->local_ip);
   LWIP_DEBUGF(UDP_DEBUG | LWIP_DBG_TRACE | LWIP_DBG_STATE, (", port %"U16_F")\n", pcb->local_port));
@@ -1116,6 +1161,9 @@ udp_connect(struct udp_pcb *pcb, const ip_addr_t *ipaddr, u16_t port)
   /* PCB not yet on the list, add PCB now */
   pcb->next = udp_pcbs;
   udp_pcbs = pcb;
+#if LWIP_UDP_PCB_HASH_SIZE
+  udp_hash_add(pcb);
+#endif /* LWIP_UDP_PCB_HASH_SIZE */
   return ERR_OK;
 }
 
@@ -1189,6 +1237,9 @@ udp_remove(struct udp_pcb *pcb)
   LWIP_ERROR("udp_remove: invalid pcb", pcb != NULL, return);
 
   mib2_udp_unbind(pcb);
+#if LWIP_UDP_PCB_HASH_SIZE
+  udp_hash_remove(pcb);
+#endif /* LWIP_UDP_PCB_HASH_SIZE */
   /* pcb to be removed is first in list? */
   if (udp_pcbs == pcb) {
     /* make list start at 2nd pcb */
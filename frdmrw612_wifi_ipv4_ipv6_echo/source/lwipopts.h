@@ -372,6 +372,12 @@ void sys_mark_tcpip_thread(void);
 #define LWIP_SOCKET    1
 #define LWIP_NETIF_API 1
 
+/**
+ * LWIP_SOCKET_MMSG==1: Enable recvmmsg()/sendmmsg(), used by the UDP echo.
+ */
+#define LWIP_SOCKET_MMSG     1
+#define LWIP_SOCKET_MMSG_MAX 4
+
 /**
  * LWIP_RECV_CB==1: Enable callback when a socket receives data.
  */
@@ -392,6 +398,12 @@ void sys_mark_tcpip_thread(void);
 #define TCP_WND (10 * TCP_MSS)
 #endif
 
+/**
+ * LWIP_PORT_TCP_WND_LIMIT==1: Limit the receive window of each TCP connection
+ * to its share of free PBUF_POOL buffers (lwip/port/tcp_wnd.c).
+ */
+#define LWIP_PORT_TCP_WND_LIMIT 1
+
 /**
  * Enable TCP_KEEPALIVE
  */
@@ -495,6 +507,22 @@ void sys_mark_tcpip_thread(void);
 
 #define LWIP_COMPAT_MUTEX_ALLOWED 1
 
+/*
+   --------------------------------------
+   ---------- Checksum options ----------
+   --------------------------------------
+*/
+/**
+ * LWIP_PORT_CHKSUM==1: Use optimized checksum routines of the port (lwip/port/chksum.c).
+ */
+#define LWIP_PORT_CHKSUM 1
+
+/**
+ * LWIP_CHECKSUM_ON_COPY==1: Calculate checksum when copying data from
+ * application buffers to pbufs.
+ */
+#define LWIP_CHECKSUM_ON_COPY 1
+
 #if (LWIP_DNS || LWIP_IGMP || LWIP_IPV6) && !defined(LWIP_RAND)
 /* When using IGMP or IPv6, LWIP_RAND() needs to be defined to a random-function returning an u32_t random value*/
 #include "lwip/arch.h"
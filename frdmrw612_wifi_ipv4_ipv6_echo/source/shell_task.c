@@ -25,6 +25,7 @@
 static shell_status_t echo_tcp_client(shell_handle_t shellHandle, int32_t argc, char **argv);
 static shell_status_t echo_tcp_server(shell_handle_t shellHandle, int32_t argc, char **argv);
 static shell_status_t echo_udp(shell_handle_t shellHandle, int32_t argc, char **argv);
+static shell_status_t echo_bench(shell_handle_t shellHandle, int32_t argc, char **argv);
 static shell_status_t end(shell_handle_t shellHandle, int32_t argc, char **argv);
 static shell_status_t print_ip_cfg(shell_handle_t shellHandle, int32_t argc, char **argv);
 
@@ -64,6 +65,18 @@ SHELL_COMMAND_DEFINE(echo_udp,
                      echo_udp,
                      1);
 
+SHELL_COMMAND_DEFINE(echo_bench,
+                     "\r\n\"echo_bench tx ip_addr port [size]\" or \"echo_bench rx port\":\r\n"
+                     "   Measures UDP throughput without printing every datagram.\r\n"
+                     "   tx sends datagrams as fast as possible to an echo_udp or echo_bench rx peer\r\n"
+                     "   and reports round trip times of datagrams echoed back, rx only counts them.\r\n"
+                     " Usage:\r\n"
+                     "   ip_addr:     IPv6 or IPv4 peer address\r\n"
+                     "   port:        UDP port number\r\n"
+                     "   size:        Datagram payload size in bytes (default 1400)\r\n",
+                     echo_bench,
+                     SHELL_IGNORE_PARAMETER_COUNT);
+
 SHELL_COMMAND_DEFINE(end, "\r\n\"end\": Ends echo_* command.\r\n", end, 0);
 SHELL_COMMAND_DEFINE(print_ip_cfg, "\r\n\"print_ip_cfg\": Prints IP configuration.\r\n", print_ip_cfg, 0);
 
@@ -122,6 +135,53 @@ static shell_status_t echo_udp(shell_handle_t shellHandle, int32_t argc, char **
     return kStatus_SHELL_Success;
 }
 
+static shell_status_t echo_bench(shell_handle_t shellHandle, int32_t argc, char **argv)
+{
+    int is_tx;
+    int ret;
+
+    (void)shellHandle;
+
+    if ((argc == 3) && (strcmp(argv[1], "rx") == 0))
+    {
+        is_tx = 0;
+    }
+    else if (((argc == 4) || (argc == 5)) && (strcmp(argv[1], "tx") == 0))
+    {
+        is_tx = 1;
+    }
+    else
+    {
+        SHELL_Printf(s_shellHandle, "Invalid arguments, see help.\r\n");
+        return kStatus_SHELL_Error;
+    }
+
+    if (!s_is_in_default_mode)
+    {
+        SHELL_Printf(s_shellHandle, "Busy.\r\n");
+        return kStatus_SHELL_Success;
+    }
+
+    shell_task_set_mode(SHELL_MODE_NO_PROMPT);
+
+    if (is_tx)
+    {
+        ret = socket_task_bench_init(argv[2], argv[3], (argc == 5) ? atoi(argv[4]) : 1400);
+    }
+    else
+    {
+        ret = socket_task_bench_init(NULL, argv[2], 0);
+    }
+
+    if (ret < 0)
+    {
+        shell_task_set_mode(SHELL_MODE_DEFAULT);
+        SHELL_Printf(s_shellHandle, "\r\n");
+    }
+
+    return kStatus_SHELL_Success;
+}
+
 static shell_status_t end(shell_handle_t shellHandle, int32_t argc, char **argv)
 {
     (void)shellHandle;
@@ -161,6 +221,7 @@ void shell_task_init(shell_command_t **additional_commands)
     SHELL_RegisterCommand(s_shellHandle, SHELL_COMMAND(echo_tcp_client));
     SHELL_RegisterCommand(s_shellHandle, SHELL_COMMAND(echo_tcp_server));
     SHELL_RegisterCommand(s_shellHandle, SHELL_COMMAND(echo_udp));
+    SHELL_RegisterCommand(s_shellHandle, SHELL_COMMAND(echo_bench));
     SHELL_RegisterCommand(s_shellHandle, SHELL_COMMAND(end));
     SHELL_RegisterCommand(s_shellHandle, SHELL_COMMAND(print_ip_cfg));
 
@@ -11,21 +11,68 @@
 #include "lwip/sys.h"
 #include "lwip/netif.h"
 
-#define TCP_SERVER_CONNECTIONS_MAX 2
+/* Number of TCP clients served at once by the echo server, one socket is kept for listening */
+#ifndef TCP_SERVER_CONNECTIONS_MAX
+#define TCP_SERVER_CONNECTIONS_MAX (MAX_SOCKETS_TCP - 1)
+#endif
+
+#define TCP_SERVER_BUF_SIZE 1500
+
+/* How long select() waits before checking whether end was called */
+#define TCP_SERVER_SELECT_TIMEOUT_MS 50
+
+typedef struct
+{
+    int sck;
+    size_t len;
+    size_t off;
+    uint8_t buf[TCP_SERVER_BUF_SIZE];
+} tcp_server_conn_t;
+
+/* Interval of the throughput summary printed instead of per packet messages */
+#define ECHO_STATS_INTERVAL_MS 1000
+
+/* Number of datagrams echoed per recvmmsg()/sendmmsg() call */
+#define ECHO_UDP_BATCH LWIP_SOCKET_MMSG_MAX
+
+#define ECHO_BENCH_PAYLOAD_MIN ((int)sizeof(echo_bench_hdr_t))
+#define ECHO_BENCH_PAYLOAD_MAX 1472
+
+typedef struct
+{
+    uint32_t start;
+    uint32_t packets;
+    uint32_t bytes;
+    uint32_t errors;
+    uint32_t rtt_cnt;
+    uint32_t rtt_sum;
+    uint32_t rtt_min;
+    uint32_t rtt_max;
+} echo_stats_t;
+
+/* Header of every datagram sent by echo_bench tx, echoed back unchanged by the peer */
+typedef struct
+{
+    uint32_t seq;
+    uint32_t timestamp;
+} echo_bench_hdr_t;
 
 typedef struct
 {
     int sck;
-    int sck_accepted[TCP_SERVER_CONNECTIONS_MAX];
     int af;
     int sck_type;
     int is_server;
+    int bench_len;
     struct sockaddr_in ipv4;
     struct sockaddr_in6 ipv6;
 } example_sockinfo_t;
 
 volatile int run;
 static example_sockinfo_t s_sockinfo;
+static tcp_server_conn_t s_serverConns[TCP_SERVER_CONNECTIONS_MAX];
+static echo_stats_t s_serverStats;
+static uint8_t s_udpBufs[ECHO_UDP_BATCH][1500];
 static shell_handle_t s_shellHandle;
 
 static int ip_port_str_to_sockaddr(const char *ip_str,
@@ -94,6 +141,62 @@ static int ip_port_str_to_sockaddr(const char *ip_str,
     return af;
 }
 
+static void echo_stats_reset(echo_stats_t *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+    stats->rtt_min = UINT32_MAX;
+    stats->start   = sys_now();
+}
+
+static void echo_stats_add(echo_stats_t *stats, ssize_t bytes)
+{
+    if (bytes < 0)
+    {
+        stats->errors++;
+    }
+    else
+    {
+        stats->packets++;
+        stats->bytes += (uint32_t)bytes;
+    }
+}
+
+static void echo_stats_add_rtt(echo_stats_t *stats, uint32_t rtt)
+{
+    stats->rtt_cnt++;
+    stats->rtt_sum += rtt;
+    stats->rtt_min = LWIP_MIN(stats->rtt_min, rtt);
+    stats->rtt_max = LWIP_MAX(stats->rtt_max, rtt);
+}
+
+/* Prints and restarts the statistics once per interval, stays silent while there is no traffic. */
+static void echo_stats_poll(echo_stats_t *stats)
+{
+    uint32_t elapsed = sys_now() - stats->start;
+    uint32_t kbps;
+
+    if (elapsed < ECHO_STATS_INTERVAL_MS)
+    {
+        return;
+    }
+
+    if ((stats->packets != 0U) || (stats->errors != 0U))
+    {
+        kbps = (uint32_t)(((uint64_t)stats->bytes * 8U) / elapsed);
+
+        SHELL_Printf(s_shellHandle, "%u pkt/s, %u.%03u Mbps, %u errors", (unsigned int)(stats->packets * 1000U / elapsed),
+                     (unsigned int)(kbps / 1000U), (unsigned int)(kbps % 1000U), (unsigned int)stats->errors);
+        if (stats->rtt_cnt != 0U)
+        {
+            SHELL_Printf(s_shellHandle, ", rtt min/avg/max %u/%u/%u ms", (unsigned int)stats->rtt_min,
+                         (unsigned int)(stats->rtt_sum / stats->rtt_cnt), (unsigned int)stats->rtt_max);
+        }
+        SHELL_Printf(s_shellHandle, "\r\n");
+    }
+
+    echo_stats_reset(stats);
+}
+
 static int set_receive_timeout(int sck)
 {
     struct timeval timeout = {.tv_usec = 50 * 1000, .tv_sec = 0};
@@ -110,10 +213,11 @@ static int set_receive_timeout(int sck)
 static void echo_udp(int sck)
 {
     int err;
-    uint8_t buf[1500];
-
-    struct sockaddr_storage sender_addr;
-    socklen_t sender_addr_len = sizeof(sender_addr);
+    int cnt;
+    struct mmsghdr msgs[ECHO_UDP_BATCH];
+    struct iovec iovs[ECHO_UDP_BATCH];
+    struct sockaddr_storage sender_addrs[ECHO_UDP_BATCH];
+    echo_stats_t stats;
 
     SHELL_Printf(s_shellHandle, "Use end command to return...");
     shell_task_set_mode("ECHO_UDP>> ");
@@ -124,14 +228,41 @@ static void echo_udp(int sck)
         return;
     }
 
+    echo_stats_reset(&stats);
+
     while (1)
     {
-        ssize_t bytes = recvfrom(sck, &buf, sizeof(buf), 0, (struct sockaddr *)&sender_addr, &sender_addr_len);
+        echo_stats_poll(&stats);
 
-        if (bytes > 0)
+        for (int i = 0; i < ECHO_UDP_BATCH; i++)
+        {
+            iovs[i].iov_base               = s_udpBufs[i];
+            iovs[i].iov_len                = sizeof(s_udpBufs[i]);
+            msgs[i].msg_hdr.msg_name       = &sender_addrs[i];
+            msgs[i].msg_hdr.msg_namelen    = sizeof(sender_addrs[i]);
+            msgs[i].msg_hdr.msg_iov        = &iovs[i];
+            msgs[i].msg_hdr.msg_iovlen     = 1;
+            msgs[i].msg_hdr.msg_control    = NULL;
+            msgs[i].msg_hdr.msg_controllen = 0;
+            msgs[i].msg_hdr.msg_flags      = 0;
+        }
+
+        // Waits for the first datagram only, then takes whatever else is already queued.
+        cnt = recvmmsg(sck, msgs, ECHO_UDP_BATCH, 0);
+
+        if (cnt > 0)
         {
-            sendto(sck, &buf, bytes, 0, (struct sockaddr *)&sender_addr, sender_addr_len);
-            SHELL_Printf(s_shellHandle, "Datagram carrying %dB sent back.\r\n", bytes);
+            for (int i = 0; i < cnt; i++)
+            {
+                iovs[i].iov_len = msgs[i].msg_len;
+            }
+
+            // All datagrams go back with a single call into the tcpip thread.
+            int sent = sendmmsg(sck, msgs, (unsigned int)cnt, 0);
+            for (int i = 0; i < cnt; i++)
+            {
+                echo_stats_add(&stats, (i < sent) ? (ssize_t)msgs[i].msg_len : -1);
+            }
         }
         else if (!run)
         {
@@ -154,6 +285,7 @@ static void echo_loop_tcp(int sck)
 {
     int err;
     uint8_t buf[1500];
+    echo_stats_t stats;
 
     SHELL_Printf(s_shellHandle, "\r\nEchoing data. Use end command to return...");
     SHELL_Printf(s_shellHandle, "\r\n");
@@ -164,20 +296,16 @@ static void echo_loop_tcp(int sck)
         return;
     }
 
+    echo_stats_reset(&stats);
+
     while (1)
     {
+        echo_stats_poll(&stats);
+
         ssize_t bytes = read(sck, &buf, sizeof(buf));
         if (bytes > 0)
         {
-            bytes = write(sck, &buf, bytes);
-            if (bytes >= 0)
-            {
-                SHELL_Printf(s_shellHandle, "%dB sent back.\r\n", bytes);
-            }
-            else
-            {
-                SHELL_Printf(s_shellHandle, "write() failed (errno=%d)\r\n", errno);
-            }
+            echo_stats_add(&stats, write(sck, &buf, bytes));
         }
         else if (!run)
         {
@@ -239,13 +367,199 @@ static void tcp_connect_thread(void *arg)
     finish_thread(sockinfo->sck);
 }
 
-static void tcp_server_thread(void *arg)
+static tcp_server_conn_t *tcp_server_conn_alloc(void)
 {
-    int sck = *((int *)arg);
+    for (int i = 0; i < TCP_SERVER_CONNECTIONS_MAX; i++)
+    {
+        if (s_serverConns[i].sck < 0)
+        {
+            s_serverConns[i].len = 0;
+            s_serverConns[i].off = 0;
+            return &s_serverConns[i];
+        }
+    }
 
-    echo_loop_tcp(sck);
+    return NULL;
+}
 
-    finish_thread(sck);
+static void tcp_server_conn_close(tcp_server_conn_t *conn)
+{
+    close(conn->sck);
+    conn->sck = -1;
+}
+
+static void tcp_server_accept(int listen_sck)
+{
+    tcp_server_conn_t *conn = tcp_server_conn_alloc();
+    if (conn == NULL)
+    {
+        // Reached maximum connections, leave it in the backlog.
+        return;
+    }
+
+    conn->sck = accept(listen_sck, NULL, 0);
+    if (conn->sck < 0)
+    {
+        return;
+    }
+
+    fcntl(conn->sck, F_SETFL, O_NONBLOCK);
+    SHELL_Printf(s_shellHandle, "\r\nAccepted connection\r\n");
+}
+
+/* Writes out as much of the pending data as the socket accepts. Returns -1 when the connection is gone. */
+static int tcp_server_flush(tcp_server_conn_t *conn)
+{
+    while (conn->off < conn->len)
+    {
+        ssize_t bytes = write(conn->sck, &conn->buf[conn->off], conn->len - conn->off);
+        if (bytes < 0)
+        {
+            if (errno == EWOULDBLOCK)
+            {
+                return 0;
+            }
+            echo_stats_add(&s_serverStats, bytes);
+            return -1;
+        }
+        conn->off += (size_t)bytes;
+    }
+
+    echo_stats_add(&s_serverStats, (ssize_t)conn->len);
+    conn->len = 0;
+    conn->off = 0;
+
+    return 0;
+}
+
+static int tcp_server_echo(tcp_server_conn_t *conn)
+{
+    ssize_t bytes = read(conn->sck, conn->buf, sizeof(conn->buf));
+    if (bytes > 0)
+    {
+        conn->len = (size_t)bytes;
+        conn->off = 0;
+        return tcp_server_flush(conn);
+    }
+    else if ((bytes < 0) && (errno == EWOULDBLOCK))
+    {
+        return 0;
+    }
+
+    SHELL_Printf(s_shellHandle, "Connection terminated. (errno=%d).\r\n", (bytes == 0) ? 0 : errno);
+    return -1;
+}
+
+/* Serves the listening socket and all accepted connections from this single task */
+static void tcp_server_loop(int listen_sck)
+{
+    fd_set rset;
+    fd_set wset;
+    int maxfd;
+    int ret;
+    int free_slot;
+    struct timeval timeout;
+
+    for (int i = 0; i < TCP_SERVER_CONNECTIONS_MAX; i++)
+    {
+        s_serverConns[i].sck = -1;
+    }
+    echo_stats_reset(&s_serverStats);
+
+    while (run)
+    {
+        echo_stats_poll(&s_serverStats);
+
+        FD_ZERO(&rset);
+        FD_ZERO(&wset);
+        maxfd     = -1;
+        free_slot = 0;
+
+        for (int i = 0; i < TCP_SERVER_CONNECTIONS_MAX; i++)
+        {
+            tcp_server_conn_t *conn = &s_serverConns[i];
+
+            if (conn->sck < 0)
+            {
+                free_slot = 1;
+                continue;
+            }
+
+            /* Stop reading while echoed data is still waiting for send buffer space */
+            if (conn->off < conn->len)
+            {
+                FD_SET(conn->sck, &wset);
+            }
+            else
+            {
+                FD_SET(conn->sck, &rset);
+            }
+            maxfd = LWIP_MAX(maxfd, conn->sck);
+        }
+
+        if (free_slot)
+        {
+            FD_SET(listen_sck, &rset);
+            maxfd = LWIP_MAX(maxfd, listen_sck);
+        }
+
+        timeout.tv_sec  = 0;
+        timeout.tv_usec = TCP_SERVER_SELECT_TIMEOUT_MS * 1000;
+
+        ret = select(maxfd + 1, &rset, &wset, NULL, &timeout);
+        if (ret < 0)
+        {
+            SHELL_Printf(s_shellHandle, "select() failed (errno=%d)\r\n", errno);
+            break;
+        }
+        else if (ret == 0)
+        {
+            // Timeout is here to allow check if we should continue.
+            continue;
+        }
+
+        if (free_slot && FD_ISSET(listen_sck, &rset))
+        {
+            tcp_server_accept(listen_sck);
+        }
+
+        for (int i = 0; i < TCP_SERVER_CONNECTIONS_MAX; i++)
+        {
+            tcp_server_conn_t *conn = &s_serverConns[i];
+
+            if (conn->sck < 0)
+            {
+                continue;
+            }
+
+            if (FD_ISSET(conn->sck, &wset))
+            {
+                ret = tcp_server_flush(conn);
+            }
+            else if (FD_ISSET(conn->sck, &rset))
+            {
+                ret = tcp_server_echo(conn);
+            }
+            else
+            {
+                ret = 0;
+            }
+
+            if (ret < 0)
+            {
+                tcp_server_conn_close(conn);
+            }
+        }
+    }
+
+    // Listen thread stopped, clean up connections
+    for (int i = 0; i < TCP_SERVER_CONNECTIONS_MAX; i++)
+    {
+        if (s_serverConns[i].sck >= 0)
+        {
+            tcp_server_conn_close(&s_serverConns[i]);
+        }
+    }
 }
 
 static void tcp_listen_thread(void *arg)
@@ -273,45 +587,7 @@ static void tcp_listen_thread(void *arg)
         listen(sockinfo->sck, 0); // zero to use the smallest connection backlog possible (see tcp_backlog_set)
         fcntl(sockinfo->sck, F_SETFL, O_NONBLOCK);
 
-        run                  = 1;
-        int accepted_sck_cnt = 0;
-        while (run)
-        {
-            if (accepted_sck_cnt >= TCP_SERVER_CONNECTIONS_MAX)
-            {
-                // Reached maximum connections.
-                vTaskDelay(pdMS_TO_TICKS(50));
-                continue;
-            }
-            sockinfo->sck_accepted[accepted_sck_cnt] = accept(sockinfo->sck, NULL, 0);
-            if (sockinfo->sck_accepted[accepted_sck_cnt] < 0)
-            {
-                // Nothing to accept. Wait 50ms and try it again.
-                vTaskDelay(pdMS_TO_TICKS(50));
-            }
-            else
-            {
-                SHELL_Printf(s_shellHandle, "\r\nAccepted connection\r\n");
-
-                // Create thread that serves this connection
-                sys_thread_t thread =
-                    sys_thread_new("tcp_server_thread", tcp_server_thread,
-                                   (void *)&(sockinfo->sck_accepted[accepted_sck_cnt]), 1024, DEFAULT_THREAD_PRIO);
-
-                if (thread == NULL)
-                {
-                    SHELL_Printf(s_shellHandle, "Can not create TCP connection server thread\r\n");
-                    close(sockinfo->sck_accepted[accepted_sck_cnt]);
-                    sockinfo->sck_accepted[accepted_sck_cnt] = -1;
-                }
-                else
-                {
-                    accepted_sck_cnt += 1;
-                }
-            }
-        }
-        // Listen thread stopped, clean up connections
-        accepted_sck_cnt = 0;
+        tcp_server_loop(sockinfo->sck);
     }
 
     finish_thread(sockinfo->sck);
@@ -343,17 +619,115 @@ static void udp_thread(void *arg)
     finish_thread(sockinfo->sck);
 }
 
+static void bench_rx_thread(void *arg)
+{
+    example_sockinfo_t *sockinfo = (example_sockinfo_t *)arg;
+    uint8_t buf[1500];
+    echo_stats_t stats;
+    int ret;
+
+    if (sockinfo->af == AF_INET)
+    {
+        ret = bind(sockinfo->sck, (struct sockaddr *)&sockinfo->ipv4, sizeof(sockinfo->ipv4));
+    }
+    else
+    {
+        ret = bind(sockinfo->sck, (struct sockaddr *)&sockinfo->ipv6, sizeof(sockinfo->ipv6));
+    }
+    if (ret < 0)
+    {
+        SHELL_Printf(s_shellHandle, "bind() failed (errno=%d)\r\n", errno);
+    }
+    else if (set_receive_timeout(sockinfo->sck) == 0)
+    {
+        SHELL_Printf(s_shellHandle, "Receiving datagrams. Use end command to return...\r\n");
+        shell_task_set_mode("ECHO_BENCH_RX>> ");
+
+        echo_stats_reset(&stats);
+
+        while (run)
+        {
+            echo_stats_poll(&stats);
+
+            ssize_t bytes = recv(sockinfo->sck, buf, sizeof(buf), 0);
+            if (bytes >= 0)
+            {
+                echo_stats_add(&stats, bytes);
+            }
+            else if (errno != EWOULDBLOCK)
+            {
+                SHELL_Printf(s_shellHandle, "Socket terminated. (errno=%d).\r\n", errno);
+                break;
+            }
+        }
+    }
+
+    finish_thread(sockinfo->sck);
+}
+
+static void bench_tx_thread(void *arg)
+{
+    example_sockinfo_t *sockinfo = (example_sockinfo_t *)arg;
+    uint8_t buf[ECHO_BENCH_PAYLOAD_MAX];
+    echo_bench_hdr_t hdr;
+    echo_stats_t stats;
+    uint32_t seq = 0;
+    struct sockaddr *to;
+    socklen_t to_len;
+    ssize_t bytes;
+
+    if (sockinfo->af == AF_INET)
+    {
+        to     = (struct sockaddr *)&sockinfo->ipv4;
+        to_len = sizeof(sockinfo->ipv4);
+    }
+    else
+    {
+        to     = (struct sockaddr *)&sockinfo->ipv6;
+        to_len = sizeof(sockinfo->ipv6);
+    }
+
+    SHELL_Printf(s_shellHandle, "Sending %dB datagrams. Use end command to return...\r\n", sockinfo->bench_len);
+    shell_task_set_mode("ECHO_BENCH_TX>> ");
+
+    memset(buf, 0, sizeof(buf));
+    echo_stats_reset(&stats);
+
+    while (run)
+    {
+        echo_stats_poll(&stats);
+
+        hdr.seq       = seq++;
+        hdr.timestamp = sys_now();
+        memcpy(buf, &hdr, sizeof(hdr));
+
+        bytes = sendto(sockinfo->sck, buf, sockinfo->bench_len, 0, to, to_len);
+        echo_stats_add(&stats, bytes);
+        if (bytes < 0)
+        {
+            // Out of buffers, let the stack drain them.
+            sys_msleep(1);
+        }
+
+        // Collect whatever the peer has echoed back so far.
+        while ((bytes = recv(sockinfo->sck, buf, sizeof(buf), MSG_DONTWAIT)) >= (ssize_t)sizeof(hdr))
+        {
+            memcpy(&hdr, buf, sizeof(hdr));
+            echo_stats_add_rtt(&stats, sys_now() - hdr.timestamp);
+        }
+    }
+
+    finish_thread(sockinfo->sck);
+}
+
 void socket_task_set_shell(shell_handle_t shell_handle)
 {
     s_shellHandle = shell_handle;
 }
 
-int socket_task_init(int is_tcp, const char *ip_str, const char *port_str)
+static int socket_task_start(int sck_type, const char *ip_str, const char *port_str, void (*thread_func_ptr)(void *))
 {
     example_sockinfo_t *sockinfo = &s_sockinfo;
-    void (*thread_func_ptr)(void *);
-
-    assert(s_shellHandle != NULL);
 
     const int is_server = (ip_str == NULL);
     sockinfo->is_server = is_server;
@@ -364,7 +738,7 @@ int socket_task_init(int is_tcp, const char *ip_str, const char *port_str)
         return -1;
     }
 
-    sockinfo->sck_type = (is_tcp) ? SOCK_STREAM : SOCK_DGRAM;
+    sockinfo->sck_type = sck_type;
 
     SHELL_Printf(s_shellHandle, "Creating new socket.\r\n");
     sockinfo->sck = socket(sockinfo->af, sockinfo->sck_type, 0);
@@ -374,9 +748,29 @@ int socket_task_init(int is_tcp, const char *ip_str, const char *port_str)
         return -1;
     }
 
+    run = 1;
+
+    sys_thread_t thread = sys_thread_new("socket_thread", thread_func_ptr, (void *)sockinfo, 1024, DEFAULT_THREAD_PRIO);
+
+    if (thread == NULL)
+    {
+        SHELL_Printf(s_shellHandle, "Can not create socket thread\r\n");
+        close(sockinfo->sck);
+        sockinfo->sck = -1;
+    }
+
+    return sockinfo->sck;
+}
+
+int socket_task_init(int is_tcp, const char *ip_str, const char *port_str)
+{
+    void (*thread_func_ptr)(void *);
+
+    assert(s_shellHandle != NULL);
+
     if (is_tcp)
     {
-        if (is_server)
+        if (ip_str == NULL)
         {
             thread_func_ptr = (void (*)(void *))tcp_listen_thread;
         }
@@ -390,18 +784,33 @@ int socket_task_init(int is_tcp, const char *ip_str, const char *port_str)
         thread_func_ptr = (void (*)(void *))udp_thread;
     }
 
-    run = 1;
+    return socket_task_start((is_tcp) ? SOCK_STREAM : SOCK_DGRAM, ip_str, port_str, thread_func_ptr);
+}
 
-    sys_thread_t thread = sys_thread_new("socket_thread", thread_func_ptr, (void *)sockinfo, 1024, DEFAULT_THREAD_PRIO);
+int socket_task_bench_init(const char *ip_str, const char *port_str, int payload_len)
+{
+    void (*thread_func_ptr)(void *);
 
-    if (thread == NULL)
+    assert(s_shellHandle != NULL);
+
+    if (ip_str == NULL)
     {
-        SHELL_Printf(s_shellHandle, "Can not create socket thread\r\n");
-        close(sockinfo->sck);
-        sockinfo->sck = -1;
+        thread_func_ptr = (void (*)(void *))bench_rx_thread;
+    }
+    else
+    {
+        if ((payload_len < ECHO_BENCH_PAYLOAD_MIN) || (payload_len > ECHO_BENCH_PAYLOAD_MAX))
+        {
+            SHELL_Printf(s_shellHandle, "Payload size must be %d to %d bytes\r\n", ECHO_BENCH_PAYLOAD_MIN,
+                         ECHO_BENCH_PAYLOAD_MAX);
+            return -1;
+        }
+        thread_func_ptr = (void (*)(void *))bench_tx_thread;
     }
 
-    return sockinfo->sck;
+    s_sockinfo.bench_len = payload_len;
+
+    return socket_task_start(SOCK_DGRAM, ip_str, port_str, thread_func_ptr);
 }
 
 void socket_task_terminate(void)
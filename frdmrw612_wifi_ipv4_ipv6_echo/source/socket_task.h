@@ -13,6 +13,7 @@
 
 void socket_task_set_shell(shell_handle_t shell_handle);
 int socket_task_init(int is_tcp, const char *ip_str, const char *port_str);
+int socket_task_bench_init(const char *ip_str, const char *port_str, int payload_len);
 void socket_task_terminate(void);
 void socket_task_print_ips(void);
 
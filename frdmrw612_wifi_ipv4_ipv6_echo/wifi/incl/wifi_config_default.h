@@ -1056,6 +1056,21 @@
 #define CONFIG_TX_RX_ZERO_COPY 0
 #endif
 
+/** If define CONFIG_IMU_RX_ZERO_COPY 1, received data frames are wrapped
+ *  in place as custom pbufs and the IMU rx buffer is only returned to the
+ *  firmware once lwIP frees the pbuf. Only valid for RW610 with
+ *  CONFIG_TX_RX_ZERO_COPY enabled.
+ */
+#if !defined CONFIG_IMU_RX_ZERO_COPY
+#define CONFIG_IMU_RX_ZERO_COPY 0
+#endif
+
+/** Maximum number of IMU rx buffers lwIP may hold at once, further
+ *  frames fall back to the copying path */
+#if !defined CONFIG_IMU_RX_ZERO_COPY_BUF_NUM
+#define CONFIG_IMU_RX_ZERO_COPY_BUF_NUM 8
+#endif
+
 #if !defined CONFIG_WIFI_CLOCKSYNC
 #if defined(RW610)
 #define CONFIG_WIFI_CLOCKSYNC 1
@@ -185,6 +185,7 @@ extern OSA_SEMAPHORE_HANDLE_DEFINE(uapsd_sem);
 
 #if CONFIG_WMM
 extern OSA_SEMAPHORE_HANDLE_DEFINE(txbuf_sem);
+extern OSA_EVENT_HANDLE_DEFINE(txbuf_avail_event);
 #endif
 
 #if CONFIG_STA_AMPDU_RX
@@ -1186,6 +1186,10 @@ typedef struct
 {
     mlan_list_head free_list;
     int free_cnt;
+    /** Number of times a sender blocked waiting for a buffer, per AC */
+    t_u32 wait_cnt[MAX_AC_QUEUES];
+    /** Total time senders spent blocked, per AC, in ms */
+    t_u32 wait_ms[MAX_AC_QUEUES];
 } outbuf_pool_t;
 
 typedef struct
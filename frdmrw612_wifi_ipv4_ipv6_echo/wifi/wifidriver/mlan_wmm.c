@@ -826,6 +826,36 @@ void wifi_wmm_buf_put(outbuf_t *buf)
     mlan_adap->outbuf_pool.free_cnt++;
 
     mlan_adap->callbacks.moal_semaphore_put(mlan_adap->pmoal_handle, &mlan_adap->outbuf_pool.free_list.plock);
+
+    wifi_wmm_outbuf_notify();
+}
+
+/* wake up senders blocked in wifi_wmm_wait_outbuf() */
+void wifi_wmm_outbuf_notify(void)
+{
+    (void)OSA_EventSet((osa_event_handle_t)txbuf_avail_event, WMM_TXBUF_EVENT_AVAIL);
+}
+
+/* drop wake-ups set before, to be called before checking for a buffer and then waiting */
+void wifi_wmm_outbuf_clear(void)
+{
+    (void)OSA_EventClear((osa_event_handle_t)txbuf_avail_event, WMM_TXBUF_EVENT_AVAIL);
+}
+
+/* block until a buffer is put back or a paused RA is resumed, or timeout */
+int wifi_wmm_wait_outbuf(mlan_wmm_ac_e queue, t_u32 timeout_ms)
+{
+    osa_event_flags_t set_flags = 0;
+    osa_status_t status;
+    t_u32 start = OSA_TimeGetMsec();
+
+    status = OSA_EventWait((osa_event_handle_t)txbuf_avail_event, WMM_TXBUF_EVENT_AVAIL, false, timeout_ms,
+                           &set_flags);
+
+    mlan_adap->outbuf_pool.wait_cnt[queue]++;
+    mlan_adap->outbuf_pool.wait_ms[queue] += OSA_TimeGetMsec() - start;
+
+    return (status == KOSA_StatusSuccess) ? WM_SUCCESS : -WM_E_BUSY;
 }
 
 /* init free list, insert all buffers to free list */
@@ -20,9 +20,19 @@
 /* Magic numbers to check for presence of the structures below */
 #define MFLASH_DIR_MAGIC_NO  (0xF17E07ABu)
 #define MFLASH_META_MAGIC_NO (0xABECEDA8u)
-#define MFLASH_FS_VERSION    (0x00010000u)
+#define MFLASH_LOG_MAGIC_NO  (0x10C5EC0Du)
 #define MFLASH_BLANK_PATTERN (0xFFu)
 
+/* Log mode uses different file layout, major version differs so that switching the mode formats the filesystem */
+#if MFLASH_FILE_LOG
+#define MFLASH_FS_VERSION (0x00020000u)
+#else
+#define MFLASH_FS_VERSION (0x00010000u)
+#endif
+
+/* Number of pages in a sector */
+#define MFLASH_SECTOR_PAGES (MFLASH_SECTOR_SIZE / MFLASH_PAGE_SIZE)
+
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 // linker symbols imported as described in https://www.keil.com/support/man/docs/armlink/armlink_pge1362065952432.htm
 extern char Image$$mflash_fs$$Base[];
@@ -71,9 +81,45 @@ typedef struct
     uint32_t magic_no;
 } mflash_file_meta_t;
 
+/*
+ * Header of a file version in log mode, the file data follows immediately.
+ * Each save appends a new record starting at page boundary, the valid record with the highest sequence number is the
+ * current file content.
+ */
+typedef struct
+{
+    uint32_t magic_no;
+    uint32_t seq_no;
+    uint32_t file_size;
+    uint32_t crc; /* CRC-32 of seq_no, file_size and file data */
+} mflash_log_record_t;
+
+/* Number of pages occupied by log record holding file data of given size */
+#define MFLASH_LOG_RECORD_PAGES(size) \
+    (((size) + sizeof(mflash_log_record_t) + MFLASH_PAGE_SIZE - 1u) / MFLASH_PAGE_SIZE)
+
+/*
+ * Number of pages a log area needs to append record of new_pages while the newest record of cur_pages is kept intact:
+ * both records, pages skipped when wrapping around at the end of the area, and partially used sectors at both ends.
+ */
+#define MFLASH_LOG_AREA_PAGES(cur_pages, new_pages) \
+    ((cur_pages) + 2u * (new_pages) + 3u * MFLASH_SECTOR_PAGES - 4u)
+
 /* Pointer to the filesystem */
 static mflash_fs_t *g_mflash_fs = NULL;
 
+#if MFLASH_DIR_INDEX_SIZE > 0
+#if (MFLASH_DIR_INDEX_SIZE & (MFLASH_DIR_INDEX_SIZE - 1)) != 0
+#error "MFLASH_DIR_INDEX_SIZE shall be power of 2"
+#endif
+
+/* Hash index of directory records, slot holds record number + 1, zero marks empty slot */
+static uint16_t s_dir_index[MFLASH_DIR_INDEX_SIZE];
+
+/* Filesystem the index is valid for */
+static mflash_fs_t *s_dir_index_fs = NULL;
+#endif
+
 /* API - True if mflash is already initialized */
 bool mflash_is_initialized(void)
 {
@@ -139,6 +185,22 @@ static bool dir_path_match(mflash_dir_record_t *dr, const char *path)
     return true;
 }
 
+#if MFLASH_DIR_INDEX_SIZE > 0
+/* FNV-1a hash of path string, limited to the length of path stored in directory record */
+static uint32_t dir_path_hash(const uint8_t *path)
+{
+    uint32_t hash = 2166136261u;
+
+    for (int i = 0; (i < MFLASH_MAX_PATH_LEN) && (path[i] != (uint8_t)'\0'); i++)
+    {
+        hash ^= path[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+#endif
+
 /* Buffer allocation wrapper */
 static void *mflash_page_buf_get(void)
 {
@@ -282,6 +344,7 @@ static status_t mflash_fs_check(mflash_fs_t *fs)
     return status;
 }
 
+#if !MFLASH_FILE_LOG
 /* Check for presence of a file data */
 static status_t mflash_file_check(mflash_fs_t *fs, mflash_dir_record_t *dr)
 {
@@ -326,6 +389,48 @@ static status_t mflash_file_check(mflash_fs_t *fs, mflash_dir_record_t *dr)
 
     return kStatus_Success;
 }
+#endif /* !MFLASH_FILE_LOG */
+
+/* Build hash index of directory records of a valid filesystem */
+static void mflash_dir_index_build(mflash_fs_t *fs)
+{
+#if MFLASH_DIR_INDEX_SIZE > 0
+    uint32_t file_count = fs->header.file_count;
+
+    s_dir_index_fs = NULL;
+
+    /* Keep at least one slot empty to terminate probing, otherwise fall back to linear search */
+    if (file_count >= MFLASH_DIR_INDEX_SIZE)
+    {
+        return;
+    }
+
+    (void)memset(s_dir_index, 0, sizeof(s_dir_index));
+
+    /* Insert records in directory order so that probing finds the first of duplicate paths, same as linear search */
+    for (uint32_t i = 0u; i < file_count; i++)
+    {
+        uint32_t slot = dir_path_hash(fs->records[i].path) & (MFLASH_DIR_INDEX_SIZE - 1u);
+
+        while (s_dir_index[slot] != 0u)
+        {
+            slot = (slot + 1u) & (MFLASH_DIR_INDEX_SIZE - 1u);
+        }
+
+        s_dir_index[slot] = (uint16_t)(i + 1u);
+    }
+
+    s_dir_index_fs = fs;
+#endif
+}
+
+/* Invalidate hash index of directory records */
+static void mflash_dir_index_clear(void)
+{
+#if MFLASH_DIR_INDEX_SIZE > 0
+    s_dir_index_fs = NULL;
+#endif
+}
 
 /* Searches for directory record with given path and retrieves a copy of it */
 static status_t mflash_dir_lookup(mflash_fs_t *fs, const char *path, mflash_dir_record_t *dr_ptr)
@@ -333,6 +438,28 @@ static status_t mflash_dir_lookup(mflash_fs_t *fs, const char *path, mflash_dir_
     uint32_t file_count     = fs->header.file_count;
     mflash_dir_record_t *dr = fs->records;
 
+#if MFLASH_DIR_INDEX_SIZE > 0
+    /* Probe the hash index if available */
+    if (fs == s_dir_index_fs)
+    {
+        for (uint32_t slot = dir_path_hash((const uint8_t *)path) & (MFLASH_DIR_INDEX_SIZE - 1u);
+             s_dir_index[slot] != 0u; slot = (slot + 1u) & (MFLASH_DIR_INDEX_SIZE - 1u))
+        {
+            dr = &fs->records[s_dir_index[slot] - 1u];
+            if (dir_path_match(dr, path))
+            {
+                if (NULL != dr_ptr)
+                {
+                    *dr_ptr = *dr;
+                }
+                return kStatus_Success;
+            }
+        }
+
+        return kStatus_Fail;
+    }
+#endif
+
     for (uint32_t i = 0u; i < file_count; i++)
     {
         if (dir_path_match(dr, path))
@@ -349,6 +476,18 @@ static status_t mflash_dir_lookup(mflash_fs_t *fs, const char *path, mflash_dir_
     return kStatus_Fail;
 }
 
+/* Number of sectors to be pre-allocated for file of given maximum size */
+static uint32_t mflash_file_sectors(uint32_t max_size)
+{
+#if MFLASH_FILE_LOG
+    uint32_t record_pages = MFLASH_LOG_RECORD_PAGES(max_size);
+
+    return (MFLASH_LOG_AREA_PAGES(record_pages, record_pages) + MFLASH_SECTOR_PAGES - 1u) / MFLASH_SECTOR_PAGES;
+#else
+    return (max_size + MFLASH_SECTOR_SIZE - 1) / MFLASH_SECTOR_SIZE;
+#endif
+}
+
 /* Create filesystem structure in FLASH according to given directory template */
 static status_t mflash_format_internal(mflash_fs_t *fs,
                                        void *page_buf,
@@ -378,7 +517,7 @@ static status_t mflash_format_internal(mflash_fs_t *fs,
          dt++)
     {
         /* Calculate number of sectors to be occupied by the file */
-        uint32_t file_sectors = (dt->max_size + MFLASH_SECTOR_SIZE - 1) / MFLASH_SECTOR_SIZE;
+        uint32_t file_sectors = mflash_file_sectors(dt->max_size);
         total_sectors += file_sectors;
         file_count++;
     }
@@ -421,7 +560,7 @@ static status_t mflash_format_internal(mflash_fs_t *fs,
         const mflash_file_t *dt = &dir_template[fi];
 
         /* Calculate number of sectors to be occupied by the file */
-        uint32_t file_sectors = (dt->max_size + MFLASH_SECTOR_SIZE - 1) / MFLASH_SECTOR_SIZE;
+        uint32_t file_sectors = mflash_file_sectors(dt->max_size);
 
         /* Fill in directory record */
         dr->alloc_size  = file_sectors * MFLASH_SECTOR_SIZE;
@@ -521,12 +660,16 @@ static status_t mflash_fs_init(mflash_fs_t *fs, uint32_t fs_size_limit, const mf
 {
     status_t status;
 
+    /* The filesystem may get formatted, drop the index until the directory is known to be valid */
+    mflash_dir_index_clear();
+
     /* Check whether there is a filesystem header and directory already in place */
     status = mflash_fs_check(fs);
 
     /* Filesystem is valid, check whether its directory provides records for all required files */
     if (status == kStatus_Success)
     {
+        mflash_dir_index_build(fs);
         status = mflash_template_match(fs, dir_template);
     }
 
@@ -534,7 +677,12 @@ static status_t mflash_fs_init(mflash_fs_t *fs, uint32_t fs_size_limit, const mf
     if (status == kStatus_Fail) /* Error codes other then 'Fail' are not captured here but rather intentinally passed to
                                    the caller */
     {
+        mflash_dir_index_clear();
         status = mflash_format(fs, fs_size_limit, dir_template); /* Format the filestem */
+        if (status == kStatus_Success)
+        {
+            mflash_dir_index_build(fs);
+        }
     }
 
     if (status == kStatus_Success)
@@ -577,6 +725,236 @@ status_t mflash_init(const mflash_file_t *dir_template, bool init_drv)
     return mflash_fs_init(fs, 0, dir_template);
 }
 
+#if MFLASH_FILE_LOG
+/* CRC-32 (IEEE 802.3), processed by nibbles to keep the table small */
+static uint32_t mflash_log_crc32(uint32_t crc, const uint8_t *data, uint32_t size)
+{
+    static const uint32_t crc_table[16] = {
+        0x00000000u, 0x1DB71064u, 0x3B6E20C8u, 0x26D930ACu, 0x76DC4190u, 0x6B6B51F4u, 0x4DB26158u, 0x5005713Cu,
+        0xEDB88320u, 0xF00F9344u, 0xD6D6A3E8u, 0xCB61B38Cu, 0x9B64C2B0u, 0x86D3D2D4u, 0xA00AE278u, 0xBDBDF21Cu};
+
+    crc = ~crc;
+    while (size-- > 0u)
+    {
+        crc ^= *data++;
+        crc = (crc >> 4) ^ crc_table[crc & 0x0Fu];
+        crc = (crc >> 4) ^ crc_table[crc & 0x0Fu];
+    }
+
+    return ~crc;
+}
+
+/* CRC of log record covering sequence number, size and data */
+static uint32_t mflash_log_record_crc(uint32_t seq_no, uint32_t file_size, const uint8_t *data)
+{
+    uint32_t crc;
+
+    crc = mflash_log_crc32(0u, (const uint8_t *)&seq_no, sizeof(seq_no));
+    crc = mflash_log_crc32(crc, (const uint8_t *)&file_size, sizeof(file_size));
+
+    return mflash_log_crc32(crc, data, file_size);
+}
+
+/* Check whether page of the filesystem is erased */
+static bool mflash_log_page_blank(mflash_fs_t *fs, uint32_t page_offset)
+{
+    const uint32_t *word = mflash_fs_get_ptr(fs, page_offset);
+
+    if (mflash_readable_check((void *)word, MFLASH_PAGE_SIZE) != kStatus_Success)
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0u; i < MFLASH_PAGE_SIZE / sizeof(uint32_t); i++)
+    {
+        if (word[i] != UINT32_MAX)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Check for valid log record at given page of the file area, returns number of pages occupied by it or 0 */
+static uint32_t mflash_log_record_check(mflash_fs_t *fs, mflash_dir_record_t *dr, uint32_t page)
+{
+    mflash_log_record_t *rec = mflash_fs_get_ptr(fs, dr->file_offset + page * MFLASH_PAGE_SIZE);
+    uint32_t area_pages      = dr->alloc_size / MFLASH_PAGE_SIZE;
+    uint32_t record_pages;
+
+    if (mflash_readable_check(rec, sizeof(mflash_log_record_t)) != kStatus_Success)
+    {
+        return 0u;
+    }
+
+    if (rec->magic_no != MFLASH_LOG_MAGIC_NO || rec->file_size > dr->alloc_size)
+    {
+        return 0u;
+    }
+
+    /* Record has to fit the area */
+    record_pages = MFLASH_LOG_RECORD_PAGES(rec->file_size);
+    if (record_pages > area_pages - page)
+    {
+        return 0u;
+    }
+
+    if (mflash_readable_check(rec, record_pages * MFLASH_PAGE_SIZE) != kStatus_Success)
+    {
+        return 0u;
+    }
+
+    /* Interrupted save leaves record with bad CRC behind */
+    if (rec->crc != mflash_log_record_crc(rec->seq_no, rec->file_size, (const uint8_t *)(rec + 1)))
+    {
+        return 0u;
+    }
+
+    return record_pages;
+}
+
+/* Find the newest valid log record of a file, retrieves its page index within the file area */
+static status_t mflash_log_lookup(mflash_fs_t *fs, mflash_dir_record_t *dr, uint32_t *pnewest)
+{
+    uint32_t area_pages = dr->alloc_size / MFLASH_PAGE_SIZE;
+    uint32_t newest_seq = 0u;
+    bool found          = false;
+
+    for (uint32_t page = 0u; page < area_pages;)
+    {
+        uint32_t record_pages = mflash_log_record_check(fs, dr, page);
+        if (record_pages == 0u)
+        {
+            page++;
+            continue;
+        }
+
+        mflash_log_record_t *rec = mflash_fs_get_ptr(fs, dr->file_offset + page * MFLASH_PAGE_SIZE);
+        if (!found || (rec->seq_no > newest_seq))
+        {
+            found      = true;
+            newest_seq = rec->seq_no;
+            *pnewest   = page;
+        }
+
+        /* Skip the record data */
+        page += record_pages;
+    }
+
+    return found ? kStatus_Success : kStatus_Fail;
+}
+
+/* Save file by appending a new record to the file area, erasing only sectors holding outdated records */
+static status_t mflash_file_save_internal(
+    mflash_fs_t *fs, void *page_buf, mflash_dir_record_t *dr, const uint8_t *data, uint32_t size)
+{
+    status_t status;
+    mflash_log_record_t *rec;
+    uint32_t area_pages   = dr->alloc_size / MFLASH_PAGE_SIZE;
+    uint32_t record_pages = MFLASH_LOG_RECORD_PAGES(size);
+    uint32_t newest       = 0u;
+    uint32_t newest_pages = 0u;
+    uint32_t seq_no       = 0u;
+    uint32_t page         = 0u;
+    uint32_t record_offset;
+
+    status = mflash_log_lookup(fs, dr, &newest);
+    if (status == kStatus_Success)
+    {
+        rec          = mflash_fs_get_ptr(fs, dr->file_offset + newest * MFLASH_PAGE_SIZE);
+        newest_pages = MFLASH_LOG_RECORD_PAGES(rec->file_size);
+        seq_no       = rec->seq_no + 1u;
+        page         = newest + newest_pages;
+
+        /* Skip whatever an interrupted save left behind in the rest of the sector, the next sectors get erased anyway */
+        for (uint32_t p = page; (p < area_pages) && ((p % MFLASH_SECTOR_PAGES) != 0u); p++)
+        {
+            if (!mflash_log_page_blank(fs, dr->file_offset + p * MFLASH_PAGE_SIZE))
+            {
+                page = p + 1u;
+            }
+        }
+    }
+
+    /* Check whether the area is large enough to keep the newest record while writing the new one */
+    if (MFLASH_LOG_AREA_PAGES(newest_pages, record_pages) > area_pages)
+    {
+        return kStatus_OutOfRange;
+    }
+
+    /* Records are kept contiguous for direct mapped access, wrap around if the end of the area is reached */
+    if (page + record_pages > area_pages)
+    {
+        page = 0u;
+    }
+    record_offset = dr->file_offset + page * MFLASH_PAGE_SIZE;
+
+    /* Erase the sectors the record is going to extend into, these hold outdated records only */
+    for (uint32_t p = page; p < page + record_pages; p++)
+    {
+        if ((p % MFLASH_SECTOR_PAGES) != 0u)
+        {
+            continue;
+        }
+
+        /* Never erase the newest record, guaranteed by the area size check above */
+        if ((newest_pages != 0u) && (p < newest + newest_pages) && (newest < p + MFLASH_SECTOR_PAGES))
+        {
+            return kStatus_Fail;
+        }
+
+        status = mflash_fs_sector_erase(fs, dr->file_offset + p * MFLASH_PAGE_SIZE);
+        if (status != kStatus_Success)
+        {
+            return status;
+        }
+    }
+
+    /* Program the record data page by page, skipping the first page containing record header that is going to be
+     * programmed in the last step */
+    for (uint32_t data_offset = MFLASH_PAGE_SIZE - sizeof(mflash_log_record_t); data_offset < size;
+         data_offset += MFLASH_PAGE_SIZE)
+    {
+        uint32_t copy_size = size - data_offset;
+        if (copy_size > MFLASH_PAGE_SIZE)
+        {
+            copy_size = MFLASH_PAGE_SIZE;
+        }
+
+        (void)memset(page_buf, (int)MFLASH_BLANK_PATTERN, MFLASH_PAGE_SIZE);
+        (void)memcpy(page_buf, data + data_offset, copy_size);
+
+        status = mflash_fs_page_program(fs, record_offset + data_offset + sizeof(mflash_log_record_t), page_buf);
+        if (status != kStatus_Success)
+        {
+            return status;
+        }
+    }
+
+    /* Prepare the missing portion of data to be programmed to the first page */
+    uint32_t copy_size = size;
+    if (copy_size > MFLASH_PAGE_SIZE - sizeof(mflash_log_record_t))
+    {
+        copy_size = MFLASH_PAGE_SIZE - sizeof(mflash_log_record_t);
+    }
+
+    (void)memset(page_buf, (int)MFLASH_BLANK_PATTERN, MFLASH_PAGE_SIZE);
+    (void)memcpy((uint8_t *)page_buf + sizeof(mflash_log_record_t), data, copy_size);
+
+    /* Set record header */
+    rec            = (mflash_log_record_t *)page_buf;
+    rec->magic_no  = MFLASH_LOG_MAGIC_NO;
+    rec->seq_no    = seq_no;
+    rec->file_size = size;
+    rec->crc       = mflash_log_record_crc(seq_no, size, data);
+
+    /* Program the first page putting the header in place which makes the record the newest valid one */
+    status = mflash_fs_page_program(fs, record_offset, page_buf);
+
+    return status;
+}
+#else
 /* Save file */
 static status_t mflash_file_save_internal(
     mflash_fs_t *fs, void *page_buf, mflash_dir_record_t *dr, const uint8_t *data, uint32_t size)
@@ -645,6 +1023,7 @@ static status_t mflash_file_save_internal(
 
     return status;
 }
+#endif /* MFLASH_FILE_LOG */
 
 /* API, save data to file with given path */
 status_t mflash_file_save(const char *path, const uint8_t *data, uint32_t size)
@@ -691,6 +1070,24 @@ status_t mflash_file_save(const char *path, const uint8_t *data, uint32_t size)
 static status_t mflash_file_mmap_internal(mflash_fs_t *fs, mflash_dir_record_t *dr, const uint8_t **pdata, uint32_t *psize)
 {
     status_t status;
+#if MFLASH_FILE_LOG
+    mflash_log_record_t *rec;
+    uint32_t newest;
+
+    /* The newest valid record holds the file content */
+    status = mflash_log_lookup(fs, dr, &newest);
+    if (status != kStatus_Success)
+    {
+        return status;
+    }
+
+    rec = mflash_fs_get_ptr(fs, dr->file_offset + newest * MFLASH_PAGE_SIZE);
+
+    *pdata = (uint8_t *)rec + sizeof(*rec);
+    *psize = rec->file_size;
+
+    return kStatus_Success;
+#else
     mflash_file_meta_t *meta;
 
     status = mflash_file_check(fs, dr);
@@ -705,6 +1102,7 @@ static status_t mflash_file_mmap_internal(mflash_fs_t *fs, mflash_dir_record_t *
     *psize = meta->file_size;
 
     return kStatus_Success;
+#endif /* MFLASH_FILE_LOG */
 }
 
 /* API, get direct pointer to data of file with given path */
@@ -0,0 +1,143 @@
+/*
+ * Copyright 2025 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "lwip/opt.h"
+
+#if defined(LWIP_PORT_CHKSUM) && LWIP_PORT_CHKSUM
+
+#include <string.h>
+
+#include "lwip/def.h"
+#include "lwip/inet_chksum.h"
+
+/*
+ * The sum is accumulated from 32-bit words loaded from the start of the data, regardless of its alignment.
+ * Cortex-M33 handles unaligned LDR/STR in hardware, memcpy() of a word compiles to a single load or store.
+ * Each word is added to a 64-bit accumulator, which cannot overflow for lengths handled by lwIP,
+ * so carries are folded only once at the end.
+ *
+ * As the words always start at the first byte, the result corresponds to the data placed at an even offset,
+ * which is what lwip_standard_chksum() returns too: host order, non-inverted Internet sum.
+ */
+
+static inline u32_t chksum_load(const u8_t *src)
+{
+    u32_t w;
+
+    (void)memcpy(&w, src, sizeof(w));
+    return w;
+}
+
+static inline u16_t chksum_fold(u64_t sum)
+{
+    sum = (sum >> 32) + (sum & 0xffffffffULL);
+    sum = (sum >> 32) + (sum & 0xffffffffULL);
+    sum = (sum >> 16) + (sum & 0xffffULL);
+    sum = (sum >> 16) + (sum & 0xffffULL);
+    sum = (sum >> 16) + (sum & 0xffffULL);
+
+    return (u16_t)sum;
+}
+
+/* Adds the remaining 0-3 bytes, the last odd byte is padded by zero as the high byte in network order */
+static inline u64_t chksum_tail(u64_t sum, const u8_t *src, int len)
+{
+    u16_t t = 0;
+
+    if (len >= 2)
+    {
+        (void)memcpy(&t, src, sizeof(t));
+        sum += t;
+        src += 2;
+        len -= 2;
+        t = 0;
+    }
+
+    if (len > 0)
+    {
+        ((u8_t *)&t)[0] = *src;
+        sum += t;
+    }
+
+    return sum;
+}
+
+u16_t lwip_port_chksum(const void *dataptr, int len)
+{
+    const u8_t *src = (const u8_t *)dataptr;
+    u64_t sum       = 0;
+
+    while (len >= 32)
+    {
+        sum += chksum_load(src);
+        sum += chksum_load(src + 4);
+        sum += chksum_load(src + 8);
+        sum += chksum_load(src + 12);
+        sum += chksum_load(src + 16);
+        sum += chksum_load(src + 20);
+        sum += chksum_load(src + 24);
+        sum += chksum_load(src + 28);
+        src += 32;
+        len -= 32;
+    }
+
+    while (len >= 4)
+    {
+        sum += chksum_load(src);
+        src += 4;
+        len -= 4;
+    }
+
+    return chksum_fold(chksum_tail(sum, src, len));
+}
+
+#if LWIP_CHECKSUM_ON_COPY
+/* Copies the data like MEMCPY() and returns its checksum, the data is read only once */
+u16_t lwip_port_chksum_copy(void *dst, const void *src, u16_t len)
+{
+    u8_t *d       = (u8_t *)dst;
+    const u8_t *s = (const u8_t *)src;
+    int n         = len;
+    u64_t sum     = 0;
+    u32_t w0, w1, w2, w3;
+
+    while (n >= 16)
+    {
+        w0 = chksum_load(s);
+        w1 = chksum_load(s + 4);
+        w2 = chksum_load(s + 8);
+        w3 = chksum_load(s + 12);
+        (void)memcpy(d, &w0, sizeof(w0));
+        (void)memcpy(d + 4, &w1, sizeof(w1));
+        (void)memcpy(d + 8, &w2, sizeof(w2));
+        (void)memcpy(d + 12, &w3, sizeof(w3));
+        sum += w0;
+        sum += w1;
+        sum += w2;
+        sum += w3;
+        s += 16;
+        d += 16;
+        n -= 16;
+    }
+
+    while (n >= 4)
+    {
+        w0 = chksum_load(s);
+        (void)memcpy(d, &w0, sizeof(w0));
+        sum += w0;
+        s += 4;
+        d += 4;
+        n -= 4;
+    }
+
+    (void)memcpy(d, s, (size_t)n);
+
+    return chksum_fold(chksum_tail(sum, s, n));
+}
+#endif /* LWIP_CHECKSUM_ON_COPY */
+
+#endif /* LWIP_PORT_CHKSUM */
@@ -956,6 +956,44 @@ netconn_send(struct netconn *conn, struct netbuf *buf)
   return err;
 }
 
+#if LWIP_SOCKET_MMSG
+/**
+ * @ingroup netconn_udp
+ * Send several netbufs over a UDP or RAW netconn with a single call into
+ * the tcpip thread. Sending stops at the first netbuf that fails.
+ *
+ * @param conn the UDP or RAW netconn over which to send data
+ * @param bufs array of netbufs, each holding data and destination
+ * @param count number of netbufs in bufs
+ * @param sent returns the number of netbufs sent (may be NULL)
+ * @return ERR_OK if all netbufs were sent, the error of the first failing one otherwise
+ */
+err_t
+netconn_send_multi(struct netconn *conn, struct netbuf **bufs, u16_t count, u16_t *sent)
+{
+  API_MSG_VAR_DECLARE(msg);
+  err_t err;
+
+  LWIP_ERROR("netconn_send_multi: invalid conn",  (conn != NULL), return ERR_ARG;);
+  LWIP_ERROR("netconn_send_multi: invalid bufs",  (bufs != NULL) || (count == 0), return ERR_ARG;);
+
+  LWIP_DEBUGF(API_LIB_DEBUG, ("netconn_send_multi: sending %"U16_F" netbufs\n", count));
+
+  API_MSG_VAR_ALLOC(msg);
+  API_MSG_VAR_REF(msg).conn = conn;
+  API_MSG_VAR_REF(msg).msg.bm.bufs = bufs;
+  API_MSG_VAR_REF(msg).msg.bm.count = count;
+  API_MSG_VAR_REF(msg).msg.bm.sent = 0;
+  err = netconn_apimsg(lwip_netconn_do_send_multi, &API_MSG_VAR_REF(msg));
+  if (sent != NULL) {
+    *sent = API_MSG_VAR_REF(msg).msg.bm.sent;
+  }
+  API_MSG_VAR_FREE(msg);
+
+  return err;
+}
+#endif /* LWIP_SOCKET_MMSG */
+
 /**
  * @ingroup netconn_tcp
  * Send data over a TCP netconn.
@@ -1447,7 +1447,7 @@ lwip_send(int s, const void *data, size_t size, int flags)
 #endif /* (LWIP_UDP || LWIP_RAW) */
   }
 
-  write_flags = (u8_t)(NETCONN_COPY |
+  write_flags = (u8_t)(((flags & MSG_NOCOPY)   ? NETCONN_NOCOPY    : NETCONN_COPY) |
                        ((flags & MSG_MORE)     ? NETCONN_MORE      : 0) |
                        ((flags & MSG_DONTWAIT) ? NETCONN_DONTBLOCK : 0));
   written = 0;
@@ -1723,6 +1723,203 @@ lwip_sendto(int s, const void *data, size_t size, int flags,
   return (err == ERR_OK ? short_size : -1);
 }
 
+#if LWIP_SOCKET_MMSG
+/* Prepare the netbuf for one sendmmsg() entry: set the destination and copy
+   the IO vectors into a single pbuf. The payload length is returned in *len,
+   sending prepends the protocol headers to the same pbuf. The netbuf is always
+   left in a state netbuf_free() can handle. */
+static err_t
+lwip_sendmmsg_netbuf(struct lwip_sock *sock, const struct msghdr *msg, struct netbuf *buf, u16_t *len)
+{
+  msg_iovlen_t i;
+  size_t size = 0;
+  size_t offset = 0;
+
+  memset(buf, 0, sizeof(struct netbuf));
+
+  if ((msg->msg_iov == NULL) || (msg->msg_iovlen <= 0) || (msg->msg_iovlen > IOV_MAX)) {
+    return ERR_VAL;
+  }
+  if (!(((msg->msg_name == NULL) && (msg->msg_namelen == 0)) || IS_SOCK_ADDR_LEN_VALID(msg->msg_namelen))) {
+    return ERR_ARG;
+  }
+  for (i = 0; i < msg->msg_iovlen; i++) {
+    size += msg->msg_iov[i].iov_len;
+    if ((msg->msg_iov[i].iov_len > 0xFFFF) || (size > 0xFFFF)) {
+      return ERR_VAL;
+    }
+  }
+
+  if (msg->msg_name) {
+    u16_t remote_port;
+    SOCKADDR_TO_IPADDR_PORT((const struct sockaddr *)msg->msg_name, &buf->addr, remote_port);
+    netbuf_fromport(buf) = remote_port;
+  }
+
+  if (netbuf_alloc(buf, (u16_t)size) == NULL) {
+    return ERR_MEM;
+  }
+  *len = (u16_t)size;
+  for (i = 0; i < msg->msg_iovlen; i++) {
+    MEMCPY(&((u8_t *)buf->p->payload)[offset], msg->msg_iov[i].iov_base, msg->msg_iov[i].iov_len);
+    offset += msg->msg_iov[i].iov_len;
+  }
+#if LWIP_CHECKSUM_ON_COPY
+  if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) != NETCONN_RAW) {
+    u16_t chksum = ~inet_chksum_pbuf(buf->p);
+    netbuf_set_chksum(buf, chksum);
+  }
+#else /* LWIP_CHECKSUM_ON_COPY */
+  LWIP_UNUSED_ARG(sock);
+#endif /* LWIP_CHECKSUM_ON_COPY */
+
+#if LWIP_IPV4 && LWIP_IPV6
+  /* Dual-stack: Unmap IPv4 mapped IPv6 addresses */
+  if (IP_IS_V6_VAL(buf->addr) && ip6_addr_isipv4mappedipv6(ip_2_ip6(&buf->addr))) {
+    unmap_ipv4_mapped_ipv6(ip_2_ip4(&buf->addr), ip_2_ip6(&buf->addr));
+    IP_SET_TYPE_VAL(buf->addr, IPADDR_TYPE_V4);
+  }
+#endif /* LWIP_IPV4 && LWIP_IPV6 */
+
+  return ERR_OK;
+}
+
+/* Receive up to vlen datagrams. Only the first one may block, the rest are
+   taken from what is already queued on the socket. Returns the number of
+   datagrams received. */
+int
+lwip_recvmmsg(int s, struct mmsghdr *msgvec, unsigned int vlen, int flags)
+{
+  struct lwip_sock *sock;
+  unsigned int i;
+  err_t err = ERR_OK;
+
+  LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_recvmmsg(%d, msgvec=%p, vlen=%u, flags=0x%x)\n", s, (void *)msgvec, vlen, flags));
+  LWIP_ERROR("lwip_recvmmsg: invalid msgvec", (msgvec != NULL) || (vlen == 0),
+             set_errno(err_to_errno(ERR_ARG)); return -1;);
+  LWIP_ERROR("lwip_recvmmsg: unsupported flags", (flags & ~MSG_DONTWAIT) == 0,
+             set_errno(EOPNOTSUPP); return -1;);
+
+  sock = get_socket(s);
+  if (!sock) {
+    return -1;
+  }
+
+  if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) == NETCONN_TCP) {
+    set_errno(EOPNOTSUPP);
+    done_socket(sock);
+    return -1;
+  }
+
+  vlen = LWIP_MIN(vlen, LWIP_SOCKET_MMSG_MAX);
+  for (i = 0; i < vlen; i++) {
+    struct msghdr *msg = &msgvec[i].msg_hdr;
+    u16_t datagram_len = 0;
+    size_t buflen = 0;
+    msg_iovlen_t j;
+
+    if ((msg->msg_iov == NULL) || (msg->msg_iovlen <= 0) || (msg->msg_iovlen > IOV_MAX)) {
+      err = ERR_VAL;
+      break;
+    }
+    for (j = 0; j < msg->msg_iovlen; j++) {
+      buflen += msg->msg_iov[j].iov_len;
+    }
+
+    err = lwip_recvfrom_udp_raw(sock, (i == 0) ? flags : (flags | MSG_DONTWAIT), msg, &datagram_len, s);
+    if (err != ERR_OK) {
+      break;
+    }
+    if (datagram_len > buflen) {
+      msg->msg_flags |= MSG_TRUNC;
+      msgvec[i].msg_len = (unsigned int)buflen;
+    } else {
+      msgvec[i].msg_len = datagram_len;
+    }
+  }
+
+  if ((i > 0) || (err == ERR_OK)) {
+    set_errno(0);
+    done_socket(sock);
+    return (int)i;
+  }
+
+  LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_recvmmsg(%d): error is \"%s\"!\n", s, lwip_strerr(err)));
+  set_errno(err_to_errno(err));
+  done_socket(sock);
+  return -1;
+}
+
+/* Send up to vlen datagrams with a single call into the tcpip thread.
+   Returns the number of datagrams sent, stopping at the first failure. */
+int
+lwip_sendmmsg(int s, struct mmsghdr *msgvec, unsigned int vlen, int flags)
+{
+  struct lwip_sock *sock;
+  struct netbuf bufs[LWIP_SOCKET_MMSG_MAX];
+  struct netbuf *bufp[LWIP_SOCKET_MMSG_MAX];
+  u16_t lens[LWIP_SOCKET_MMSG_MAX];
+  u16_t count;
+  u16_t sent = 0;
+  u16_t i;
+  err_t err = ERR_OK;
+
+  LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_sendmmsg(%d, msgvec=%p, vlen=%u, flags=0x%x)\n", s, (void *)msgvec, vlen, flags));
+  LWIP_ERROR("lwip_sendmmsg: invalid msgvec", (msgvec != NULL) || (vlen == 0),
+             set_errno(err_to_errno(ERR_ARG)); return -1;);
+  /* UDP/RAW sends never block, MSG_DONTWAIT is accepted for compatibility */
+  LWIP_ERROR("lwip_sendmmsg: unsupported flags", (flags & ~MSG_DONTWAIT) == 0,
+             set_errno(EOPNOTSUPP); return -1;);
+
+  sock = get_socket(s);
+  if (!sock) {
+    return -1;
+  }
+
+  if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) == NETCONN_TCP) {
+    set_errno(EOPNOTSUPP);
+    done_socket(sock);
+    return -1;
+  }
+
+  count = (u16_t)LWIP_MIN(vlen, LWIP_SOCKET_MMSG_MAX);
+  for (i = 0; i < count; i++) {
+    err = lwip_sendmmsg_netbuf(sock, &msgvec[i].msg_hdr, &bufs[i], &lens[i]);
+    if (err != ERR_OK) {
+      netbuf_free(&bufs[i]);
+      break;
+    }
+    bufp[i] = &bufs[i];
+  }
+  count = i;
+
+  if (count > 0) {
+    err_t send_err = netconn_send_multi(sock->conn, bufp, count, &sent);
+    if (send_err != ERR_OK) {
+      err = send_err;
+    }
+  }
+
+  for (i = 0; i < count; i++) {
+    if (i < sent) {
+      msgvec[i].msg_len = lens[i];
+    }
+    netbuf_free(&bufs[i]);
+  }
+
+  if ((sent > 0) || (err == ERR_OK)) {
+    set_errno(0);
+    done_socket(sock);
+    return (int)sent;
+  }
+
+  LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_sendmmsg(%d): error is \"%s\"!\n", s, lwip_strerr(err)));
+  set_errno(err_to_errno(err));
+  done_socket(sock);
+  return -1;
+}
+#endif /* LWIP_SOCKET_MMSG */
+
 int
 lwip_socket(int domain, int type, int protocol)
 {
@@ -110,6 +110,26 @@ enum mqtt_message_type {
 #define MQTT_CTL_PACKET_TYPE(fixed_hdr_byte0) ((fixed_hdr_byte0 & 0xf0) >> 4)
 #define MQTT_CTL_PACKET_QOS(fixed_hdr_byte0) ((fixed_hdr_byte0 & 0x6) >> 1)
 
+/**
+ * Incoming message parser states
+ */
+enum {
+  /** First byte of fixed header */
+  MQTT_RX_STATE_TYPE,
+  /** Remaining length field of fixed header */
+  MQTT_RX_STATE_REM_LEN,
+  /** Variable header and payload of messages other than PUBLISH */
+  MQTT_RX_STATE_VAR_HDR,
+  /** PUBLISH topic length */
+  MQTT_RX_STATE_TOPIC_LEN,
+  /** PUBLISH topic */
+  MQTT_RX_STATE_TOPIC,
+  /** PUBLISH packet identifier, QoS 1 and 2 only */
+  MQTT_RX_STATE_PKT_ID,
+  /** PUBLISH payload */
+  MQTT_RX_STATE_PAYLOAD
+};
+
 /**
  * MQTT connect flags, only used in CONNECT message
  */
@@ -188,6 +208,9 @@ mqtt_ringbuf_put(struct mqtt_ringbuf_t *rb, u8_t item)
   if (rb->put >= MQTT_OUTPUT_RINGBUF_SIZE) {
     rb->put = 0;
   }
+#if MQTT_OUTPUT_REF_MAX > 0
+  rb->ring_in++;
+#endif /* MQTT_OUTPUT_REF_MAX > 0 */
 }
 
 /** Return pointer to ring buffer get position */
@@ -206,6 +229,9 @@ mqtt_ringbuf_advance_get_idx(struct mqtt_ringbuf_t *rb, u16_t len)
   if (rb->get >= MQTT_OUTPUT_RINGBUF_SIZE) {
     rb->get = rb->get - MQTT_OUTPUT_RINGBUF_SIZE;
   }
+#if MQTT_OUTPUT_REF_MAX > 0
+  rb->ring_out += len;
+#endif /* MQTT_OUTPUT_REF_MAX > 0 */
 }
 
 /** Return number of bytes in ring buffer */
@@ -225,6 +251,146 @@ mqtt_ringbuf_len(struct mqtt_ringbuf_t *rb)
 /** Return number of bytes possible to read without wrapping around */
 #define mqtt_ringbuf_linear_read_length(rb) LWIP_MIN(mqtt_ringbuf_len(rb), (MQTT_OUTPUT_RINGBUF_SIZE - (rb)->get))
 
+#if MQTT_OUTPUT_REF_MAX > 0
+/** Return referenced payload number idx counted from the oldest one */
+#define mqtt_output_ref_at(rb, idx) (&(rb)->refs[((rb)->ref_head + (idx)) % MQTT_OUTPUT_REF_MAX])
+
+/** Return 1 if all of the referenced payload has been handed to TCP */
+#define mqtt_output_ref_written(ref) ((ref)->written == (ref)->p->tot_len)
+
+/**
+ * Write as much as possible of a referenced payload to TCP, without copying it
+ * @param rb Output ring buffer
+ * @param ref Referenced payload, the ring buffer bytes queued before it must have been written already
+ * @param tpcb TCP connection handle
+ * @return ERR_OK if written completely or TCP send buffer is full, error from altcp_write otherwise
+ */
+static err_t
+mqtt_output_send_ref(struct mqtt_ringbuf_t *rb, struct mqtt_output_ref_t *ref, struct altcp_pcb *tpcb)
+{
+  while (!mqtt_output_ref_written(ref)) {
+    err_t err;
+    struct pbuf *q = ref->p;
+    u16_t offset = ref->written;
+    u16_t send_len;
+
+    /* Find the pbuf holding the first byte not yet written */
+    while (offset >= q->len) {
+      offset = (u16_t)(offset - q->len);
+      q = q->next;
+    }
+    send_len = LWIP_MIN((u16_t)(q->len - offset), altcp_sndbuf(tpcb));
+    if (send_len == 0) {
+      break;
+    }
+    err = altcp_write(tpcb, (const u8_t *)q->payload + offset, send_len,
+                      ((ref->written + send_len) < ref->p->tot_len) ? TCP_WRITE_FLAG_MORE : 0);
+    if (err != ERR_OK) {
+      return err;
+    }
+    ref->written = (u16_t)(ref->written + send_len);
+    rb->stream_sent += send_len;
+  }
+  if (mqtt_output_ref_written(ref)) {
+    ref->stream_end = rb->stream_sent;
+  }
+  return ERR_OK;
+}
+
+/**
+ * Try send as many bytes as possible from output ring buffer, with referenced
+ * payloads interleaved at the positions they were queued at
+ * @param rb Output ring buffer
+ * @param tpcb TCP connection handle
+ */
+static void
+mqtt_output_send(struct mqtt_ringbuf_t *rb, struct altcp_pcb *tpcb)
+{
+  err_t err = ERR_OK;
+  u32_t stream_start = rb->stream_sent;
+  u8_t idx = 0;
+  LWIP_ASSERT("mqtt_output_send: tpcb != NULL", tpcb != NULL);
+
+  /* Skip payloads that are only waiting to be acknowledged */
+  while ((idx < rb->ref_cnt) && mqtt_output_ref_written(mqtt_output_ref_at(rb, idx))) {
+    idx++;
+  }
+
+  for (;;) {
+    struct mqtt_output_ref_t *ref = (idx < rb->ref_cnt) ? mqtt_output_ref_at(rb, idx) : NULL;
+    u16_t send_len = mqtt_ringbuf_linear_read_length(rb);
+
+    /* Do not send ring buffer bytes queued after the next referenced payload */
+    if ((ref != NULL) && ((ref->ring_mark - rb->ring_out) < send_len)) {
+      send_len = (u16_t)(ref->ring_mark - rb->ring_out);
+    }
+    send_len = LWIP_MIN(send_len, altcp_sndbuf(tpcb));
+    if (send_len > 0) {
+      err = altcp_write(tpcb, mqtt_ringbuf_get_ptr(rb), send_len, TCP_WRITE_FLAG_COPY);
+      if (err != ERR_OK) {
+        break;
+      }
+      mqtt_ringbuf_advance_get_idx(rb, send_len);
+      rb->stream_sent += send_len;
+    } else if ((ref != NULL) && (rb->ring_out == ref->ring_mark)) {
+      err = mqtt_output_send_ref(rb, ref, tpcb);
+      if ((err != ERR_OK) || !mqtt_output_ref_written(ref)) {
+        break;
+      }
+      idx++;
+    } else {
+      break;
+    }
+  }
+
+  if (rb->stream_sent != stream_start) {
+    /* Flush */
+    altcp_output(tpcb);
+  }
+  if (err != ERR_OK) {
+    LWIP_DEBUGF(MQTT_DEBUG_WARN, ("mqtt_output_send: Send failed with err %d (\"%s\")\n", err, lwip_strerr(err)));
+  }
+}
+
+/**
+ * Account bytes acknowledged by TCP and release referenced payloads that are completely acknowledged
+ * @param rb Output ring buffer
+ * @param len Number of bytes acknowledged
+ */
+static void
+mqtt_output_acked(struct mqtt_ringbuf_t *rb, u16_t len)
+{
+  rb->stream_acked += len;
+  while (rb->ref_cnt > 0) {
+    struct mqtt_output_ref_t *ref = mqtt_output_ref_at(rb, 0);
+    if (!mqtt_output_ref_written(ref) || ((s32_t)(rb->stream_acked - ref->stream_end) < 0)) {
+      break;
+    }
+    pbuf_free(ref->p);
+    ref->p = NULL;
+    rb->ref_head = (u8_t)((rb->ref_head + 1) % MQTT_OUTPUT_REF_MAX);
+    rb->ref_cnt--;
+  }
+}
+
+/**
+ * Release all referenced payloads, TCP must not refer to them any more
+ * @param rb Output ring buffer
+ */
+static void
+mqtt_output_ref_free_all(struct mqtt_ringbuf_t *rb)
+{
+  while (rb->ref_cnt > 0) {
+    struct mqtt_output_ref_t *ref = mqtt_output_ref_at(rb, 0);
+    pbuf_free(ref->p);
+    ref->p = NULL;
+    rb->ref_head = (u8_t)((rb->ref_head + 1) % MQTT_OUTPUT_REF_MAX);
+    rb->ref_cnt--;
+  }
+}
+
+#else /* MQTT_OUTPUT_REF_MAX > 0 */
+
 /**
  * Try send as many bytes as possible from output ring buffer
  * @param rb Output ring buffer
@@ -268,6 +434,7 @@ mqtt_output_send(struct mqtt_ringbuf_t *rb, struct altcp_pcb *tpcb)
     LWIP_DEBUGF(MQTT_DEBUG_WARN, ("mqtt_output_send: Send failed with err %d (\"%s\")\n", err, lwip_strerr(err)));
   }
 }
+#endif /* MQTT_OUTPUT_REF_MAX > 0 */
 
 
 
@@ -527,6 +694,31 @@ mqtt_output_check_space(struct mqtt_ringbuf_t *rb, u16_t r_length)
   return (total_len <= mqtt_ringbuf_free(rb));
 }
 
+#if MQTT_OUTPUT_REF_MAX > 0
+/**
+ * Check output buffer space for a message with payload sent by reference
+ * @param rb Output ring buffer
+ * @param r_length Remaining length after fixed header, including payload
+ * @param ref_length Length of payload sent by reference
+ * @return 1 if message will fit, 0 if not enough buffer space or reference slots
+ */
+static u8_t
+mqtt_output_check_space_ref(struct mqtt_ringbuf_t *rb, u16_t r_length, u16_t ref_length)
+{
+  /* Start with length of type byte + remaining length kept in ring buffer */
+  u16_t total_len = (u16_t)(1 + r_length - ref_length);
+
+  LWIP_ASSERT("mqtt_output_check_space_ref: rb != NULL", rb != NULL);
+
+  do {
+    total_len++;
+    r_length >>= 7;
+  } while (r_length > 0);
+
+  return (rb->ref_cnt < MQTT_OUTPUT_REF_MAX) && (total_len <= mqtt_ringbuf_free(rb));
+}
+#endif /* MQTT_OUTPUT_REF_MAX > 0 */
+
 
 /**
  * Close connection to server
@@ -544,13 +736,24 @@ mqtt_close(mqtt_client_t *client, mqtt_connection_status_t reason)
     altcp_recv(client->conn, NULL);
     altcp_err(client->conn,  NULL);
     altcp_sent(client->conn, NULL);
-    res = altcp_close(client->conn);
-    if (res != ERR_OK) {
+#if MQTT_OUTPUT_REF_MAX > 0
+    if (client->output.ref_cnt > 0) {
+      /* TCP may still refer to payloads not yet acknowledged, drop them together with the connection */
       altcp_abort(client->conn);
-      LWIP_DEBUGF(MQTT_DEBUG_TRACE, ("mqtt_close: Close err=%s\n", lwip_strerr(res)));
+    } else
+#endif /* MQTT_OUTPUT_REF_MAX > 0 */
+    {
+      res = altcp_close(client->conn);
+      if (res != ERR_OK) {
+        altcp_abort(client->conn);
+        LWIP_DEBUGF(MQTT_DEBUG_TRACE, ("mqtt_close: Close err=%s\n", lwip_strerr(res)));
+      }
     }
     client->conn = NULL;
   }
+#if MQTT_OUTPUT_REF_MAX > 0
+  mqtt_output_ref_free_all(&client->output);
+#endif /* MQTT_OUTPUT_REF_MAX > 0 */
 
   /* Remove all pending requests */
   mqtt_clear_requests(&client->pend_req_queue);
@@ -661,24 +864,22 @@ mqtt_incoming_suback(struct mqtt_request_t *r, u8_t result)
 
 
 /**
- * Complete MQTT message received or buffer full
+ * Complete MQTT message other than PUBLISH received
  * @param client MQTT client
- * @param fixed_hdr_len length of fixed header
- * @param length length received part
- * @param remaining_length Remaining length of complete message
+ * @param length Length of variable header and payload in var_hdr_payload, limited to MQTT_VAR_HEADER_BUFFER_LEN
+ * @param var_hdr_payload Variable header and payload
+ * @return Connection status
  */
 static mqtt_connection_status_t
-mqtt_message_received(mqtt_client_t *client, u8_t fixed_hdr_len, u16_t length, u32_t remaining_length,
-                      u8_t *var_hdr_payload)
+mqtt_message_received(mqtt_client_t *client, u16_t length, u8_t *var_hdr_payload)
 {
   mqtt_connection_status_t res = MQTT_CONNECT_ACCEPTED;
 
   /* Control packet type */
-  u8_t pkt_type = MQTT_CTL_PACKET_TYPE(client->rx_buffer[0]);
+  u8_t pkt_type = MQTT_CTL_PACKET_TYPE(client->rx_type);
   u16_t pkt_id = 0;
 
-  LWIP_ASSERT("fixed_hdr_len <= client->msg_idx", fixed_hdr_len <= client->msg_idx);
-  LWIP_ERROR("buffer length mismatch", fixed_hdr_len + length <= MQTT_VAR_HEADER_BUFFER_LEN,
+  LWIP_ERROR("buffer length mismatch", length <= MQTT_VAR_HEADER_BUFFER_LEN,
              return MQTT_CONNECT_DISCONNECTED);
 
   if (pkt_type == MQTT_MSG_TYPE_CONNACK) {
@@ -705,83 +906,6 @@ mqtt_message_received(mqtt_client_t *client, u8_t fixed_hdr_len, u16_t length, u
   } else if (pkt_type == MQTT_MSG_TYPE_PINGRESP) {
     LWIP_DEBUGF(MQTT_DEBUG_TRACE, ( "mqtt_message_received: Received PINGRESP from server\n"));
 
-  } else if (pkt_type == MQTT_MSG_TYPE_PUBLISH) {
-    u16_t payload_offset = 0;
-    u16_t payload_length = length;
-    u8_t qos = MQTT_CTL_PACKET_QOS(client->rx_buffer[0]);
-
-    if (client->msg_idx == (u32_t)(fixed_hdr_len + length)) {
-      /* First publish message frame. Should have topic and pkt id*/
-      size_t var_hdr_payload_bufsize = sizeof(client->rx_buffer) - fixed_hdr_len;
-      u8_t *topic;
-      u16_t after_topic;
-      u8_t bkp;
-      u16_t topic_len;
-      u16_t qos_len = (qos ? 2U : 0U);
-      if (length < 2 + qos_len) {
-        LWIP_DEBUGF(MQTT_DEBUG_WARN,( "mqtt_message_received: Received short PUBLISH packet\n"));
-        goto out_disconnect;
-      }
-      topic_len = var_hdr_payload[0];
-      topic_len = (topic_len << 8) + (u16_t)(var_hdr_payload[1]);
-      if ((topic_len > length - (2 + qos_len)) ||
-          (topic_len > var_hdr_payload_bufsize - (2 + qos_len))) {
-        LWIP_DEBUGF(MQTT_DEBUG_WARN,( "mqtt_message_received: Received short PUBLISH packet (topic)\n"));
-        goto out_disconnect;
-      }
-
-      topic = var_hdr_payload + 2;
-      after_topic = 2 + topic_len;
-      /* Check buffer length, add one byte even for QoS 0 so that zero termination will fit */
-      if ((after_topic + (qos ? 2U : 1U)) > var_hdr_payload_bufsize) {
-        LWIP_DEBUGF(MQTT_DEBUG_WARN, ("mqtt_message_received: Receive buffer can not fit topic + pkt_id\n"));
-        goto out_disconnect;
-      }
-
-      /* id for QoS 1 and 2 */
-      if (qos > 0) {
-        if (length < after_topic + 2U) {
-          LWIP_DEBUGF(MQTT_DEBUG_WARN,( "mqtt_message_received: Received short PUBLISH packet (after_topic)\n"));
-          goto out_disconnect;
-        }
-        client->inpub_pkt_id = ((u16_t)var_hdr_payload[after_topic] << 8) + (u16_t)var_hdr_payload[after_topic + 1];
-        after_topic += 2;
-      } else {
-        client->inpub_pkt_id = 0;
-      }
-      /* Take backup of byte after topic */
-      bkp = topic[topic_len];
-      /* Zero terminate string */
-      topic[topic_len] = 0;
-      /* Payload data remaining in receive buffer */
-      payload_length = length - after_topic;
-      payload_offset = after_topic;
-
-      LWIP_DEBUGF(MQTT_DEBUG_TRACE, ("mqtt_incoming_publish: Received message with QoS %d at topic: %s, payload length %"U32_F"\n",
-                                     qos, topic, remaining_length + payload_length));
-      if (client->pub_cb != NULL) {
-        client->pub_cb(client->inpub_arg, (const char *)topic, remaining_length + payload_length);
-      }
-      /* Restore byte after topic */
-      topic[topic_len] = bkp;
-    }
-    if (payload_length > 0 || remaining_length == 0) {
-      if (length < (size_t)(payload_offset + payload_length)) {
-        LWIP_DEBUGF(MQTT_DEBUG_WARN,( "mqtt_message_received: Received short packet (payload)\n"));
-        goto out_disconnect;
-      }
-      if (client->data_cb != NULL) {
-        client->data_cb(client->inpub_arg, var_hdr_payload + payload_offset, payload_length, remaining_length == 0 ? MQTT_DATA_FLAG_LAST : 0);
-      }
-      /* Reply if QoS > 0 */
-      if (remaining_length == 0 && qos > 0) {
-        /* Send PUBACK for QoS 1 or PUBREC for QoS 2 */
-        u8_t resp_msg = (qos == 1) ? MQTT_MSG_TYPE_PUBACK : MQTT_MSG_TYPE_PUBREC;
-        LWIP_DEBUGF(MQTT_DEBUG_TRACE, ("mqtt_incoming_publish: Sending publish response: %s with pkt_id: %d\n",
-                                       mqtt_msg_type_to_str(resp_msg), client->inpub_pkt_id));
-        pub_ack_rec_rel_response(client, resp_msg, client->inpub_pkt_id, 0);
-      }
-    }
   } else {
     if (length < 2) {
       LWIP_DEBUGF(MQTT_DEBUG_WARN,( "mqtt_message_received: Received short message\n"));
@@ -833,7 +957,177 @@ out_disconnect:
 
 
 /**
- * MQTT incoming message parser
+ * Incoming PUBLISH completely received, send response if QoS > 0
+ * @param client MQTT client
+ */
+static void
+mqtt_incoming_publish_done(mqtt_client_t *client)
+{
+  u8_t qos = MQTT_CTL_PACKET_QOS(client->rx_type);
+
+  if (qos > 0) {
+    /* Send PUBACK for QoS 1 or PUBREC for QoS 2 */
+    u8_t resp_msg = (qos == 1) ? MQTT_MSG_TYPE_PUBACK : MQTT_MSG_TYPE_PUBREC;
+    LWIP_DEBUGF(MQTT_DEBUG_TRACE, ("mqtt_incoming_publish: Sending publish response: %s with pkt_id: %d\n",
+                                   mqtt_msg_type_to_str(resp_msg), client->inpub_pkt_id));
+    pub_ack_rec_rel_response(client, resp_msg, client->inpub_pkt_id, 0);
+  }
+  client->rx_state = MQTT_RX_STATE_TYPE;
+}
+
+/**
+ * Variable header of incoming PUBLISH received, continue with payload
+ * @param client MQTT client
+ */
+static void
+mqtt_incoming_publish_payload(mqtt_client_t *client)
+{
+  client->rx_state = MQTT_RX_STATE_PAYLOAD;
+  if (client->rx_rem_len == 0) {
+    /* No payload, still tell application that publish is complete */
+    if (!client->rx_skip && (client->data_cb != NULL)) {
+      client->data_cb(client->inpub_arg, client->rx_buffer, 0, MQTT_DATA_FLAG_LAST);
+    }
+    mqtt_incoming_publish_done(client);
+  }
+}
+
+/**
+ * Topic of incoming PUBLISH received
+ * @param client MQTT client
+ * @param topic Zero terminated topic, NULL if it did not fit in rx_buffer and was passed to topic callback only
+ */
+static void
+mqtt_incoming_publish_topic(mqtt_client_t *client, const char *topic)
+{
+  u8_t qos = MQTT_CTL_PACKET_QOS(client->rx_type);
+  /* Remaining length has been checked to hold packet identifier when topic length was received */
+  u32_t payload_len = client->rx_rem_len - (qos ? 2U : 0U);
+
+  LWIP_DEBUGF(MQTT_DEBUG_TRACE, ("mqtt_incoming_publish: Received message with QoS %d at topic: %s, payload length %"U32_F"\n",
+                                 qos, topic != NULL ? topic : "(streamed)", payload_len));
+  if (!client->rx_skip && (client->pub_cb != NULL)) {
+    client->pub_cb(client->inpub_arg, topic, payload_len);
+  }
+  client->rx_idx = 0;
+  if (qos > 0) {
+    client->rx_state = MQTT_RX_STATE_PKT_ID;
+  } else {
+    client->inpub_pkt_id = 0;
+    mqtt_incoming_publish_payload(client);
+  }
+}
+
+/**
+ * Feed topic bytes of incoming PUBLISH
+ * @param client MQTT client
+ * @param data Received data starting with the next topic byte
+ * @param len Number of bytes available at data, may be more than the remaining topic
+ * @return Number of bytes consumed
+ */
+static u16_t
+mqtt_incoming_publish_topic_data(mqtt_client_t *client, u8_t *data, u16_t len)
+{
+  u16_t n = (u16_t)LWIP_MIN(len, (u16_t)(client->rx_topic_len - client->rx_idx));
+  u8_t last = ((client->rx_idx + n) == client->rx_topic_len);
+
+  client->rx_rem_len -= n;
+  if (!client->rx_skip && (client->topic_cb != NULL)) {
+    client->topic_cb(client->inpub_arg, (const char *)data, n, last ? MQTT_DATA_FLAG_LAST : 0);
+  }
+
+  if ((client->rx_topic_len < MQTT_VAR_HEADER_BUFFER_LEN) && (client->rx_idx == 0) && last && (len > n)) {
+    /* Complete topic in this segment followed by one more byte: zero terminate in place */
+    u8_t bkp = data[n];
+    data[n] = 0;
+    mqtt_incoming_publish_topic(client, (const char *)data);
+    data[n] = bkp;
+    return n;
+  }
+
+  if (client->rx_topic_len < MQTT_VAR_HEADER_BUFFER_LEN) {
+    MEMCPY(&client->rx_buffer[client->rx_idx], data, n);
+  }
+  client->rx_idx = (u16_t)(client->rx_idx + n);
+  if (last) {
+    if (client->rx_topic_len < MQTT_VAR_HEADER_BUFFER_LEN) {
+      client->rx_buffer[client->rx_topic_len] = 0;
+      mqtt_incoming_publish_topic(client, (const char *)client->rx_buffer);
+    } else {
+      mqtt_incoming_publish_topic(client, NULL);
+    }
+  }
+  return n;
+}
+
+/**
+ * Fixed header received, set up parsing of the rest of the message
+ * @param client MQTT client
+ * @return Connection status
+ */
+static mqtt_connection_status_t
+mqtt_message_start(mqtt_client_t *client)
+{
+  LWIP_DEBUGF(MQTT_DEBUG_TRACE, ("mqtt_parse_incoming: Remaining length after fixed header: %"U32_F"\n", client->rx_rem_len));
+  client->rx_idx = 0;
+  if (MQTT_CTL_PACKET_TYPE(client->rx_type) == MQTT_MSG_TYPE_PUBLISH) {
+    if (client->rx_rem_len < 2) {
+      LWIP_DEBUGF(MQTT_DEBUG_WARN,( "mqtt_message_received: Received short PUBLISH packet\n"));
+      return MQTT_CONNECT_DISCONNECTED;
+    }
+    client->rx_state = MQTT_RX_STATE_TOPIC_LEN;
+  } else if (client->rx_rem_len == 0) {
+    /* Complete message with no variable header or payload received */
+    client->rx_state = MQTT_RX_STATE_TYPE;
+    return mqtt_message_received(client, 0, client->rx_buffer);
+  } else {
+    client->rx_state = MQTT_RX_STATE_VAR_HDR;
+  }
+  return MQTT_CONNECT_ACCEPTED;
+}
+
+/**
+ * Two byte field of incoming PUBLISH received
+ * @param client MQTT client
+ * @return Connection status
+ */
+static mqtt_connection_status_t
+mqtt_incoming_publish_u16(mqtt_client_t *client)
+{
+  u16_t value = (u16_t)(((u16_t)client->rx_buffer[0] << 8) | client->rx_buffer[1]);
+
+  client->rx_idx = 0;
+  if (client->rx_state == MQTT_RX_STATE_TOPIC_LEN) {
+    u16_t qos_len = MQTT_CTL_PACKET_QOS(client->rx_type) ? 2U : 0U;
+    if (client->rx_rem_len < (u32_t)value + qos_len) {
+      LWIP_DEBUGF(MQTT_DEBUG_WARN,( "mqtt_message_received: Received short PUBLISH packet (topic)\n"));
+      return MQTT_CONNECT_DISCONNECTED;
+    }
+    client->rx_topic_len = value;
+    /* Topics not fitting the receive buffer can only be passed to the topic callback */
+    client->rx_skip = (value >= MQTT_VAR_HEADER_BUFFER_LEN) && (client->topic_cb == NULL);
+    if (client->rx_skip) {
+      LWIP_DEBUGF(MQTT_DEBUG_WARN, ("mqtt_parse_incoming: Topic length %d does not fit receive buffer, dropping publish\n", value));
+    }
+    if (value == 0) {
+      client->rx_buffer[0] = 0;
+      mqtt_incoming_publish_topic(client, (const char *)client->rx_buffer);
+    } else {
+      client->rx_state = MQTT_RX_STATE_TOPIC;
+    }
+  } else {
+    client->inpub_pkt_id = value;
+    mqtt_incoming_publish_payload(client);
+  }
+  return MQTT_CONNECT_ACCEPTED;
+}
+
+/**
+ * MQTT incoming message parser.
+ * Runs as a state machine over the received pbuf segments so that messages may be split
+ * anywhere. Topic and payload of PUBLISH messages are passed to the callbacks directly from
+ * the received data, only the topic is copied if it is split over segments. Other messages
+ * are collected in client->rx_buffer before they are handled.
  * @param client MQTT client
  * @param p PBUF chain of received data
  * @return Connection status
@@ -841,87 +1135,78 @@ out_disconnect:
 static mqtt_connection_status_t
 mqtt_parse_incoming(mqtt_client_t *client, struct pbuf *p)
 {
-  u16_t in_offset = 0;
-  u32_t msg_rem_len = 0;
-  u8_t fixed_hdr_len = 0;
-  u8_t b = 0;
-
-  while (p->tot_len > in_offset) {
-    /* We ALWAYS parse the header here first. Even if the header was not
-       included in this segment, we re-parse it here by buffering it in
-       client->rx_buffer. client->msg_idx keeps track of this. */
-    if ((fixed_hdr_len < 2) || ((b & 0x80) != 0)) {
-
-      if (fixed_hdr_len < client->msg_idx) {
-        /* parse header from old pbuf (buffered in client->rx_buffer) */
-        b = client->rx_buffer[fixed_hdr_len];
-      } else {
-        /* parse header from this pbuf and save it in client->rx_buffer in case
-           it comes in segmented */
-        b = pbuf_get_at(p, in_offset++);
-        client->rx_buffer[client->msg_idx++] = b;
-      }
-      fixed_hdr_len++;
-
-      if (fixed_hdr_len >= 2) {
-        /* fixed header contains at least 2 bytes but can contain more, depending on
-           'remaining length'. All bytes but the last of this have 0x80 set to
-           indicate more bytes are coming. */
-        msg_rem_len |= (u32_t)(b & 0x7f) << ((fixed_hdr_len - 2) * 7);
-        if ((b & 0x80) == 0) {
-          /* fixed header is done */
-          LWIP_DEBUGF(MQTT_DEBUG_TRACE, ("mqtt_parse_incoming: Remaining length after fixed header: %"U32_F"\n", msg_rem_len));
-          if (msg_rem_len == 0) {
-            /* Complete message with no extra headers of payload received */
-            mqtt_message_received(client, fixed_hdr_len, 0, 0, NULL);
-            client->msg_idx = 0;
-            fixed_hdr_len = 0;
-          } else {
-            /* Bytes remaining in message (changes remaining length if this is
-               not the first segment of this message) */
-            msg_rem_len = (msg_rem_len + fixed_hdr_len) - client->msg_idx;
+  struct pbuf *q;
+
+  for (q = p; q != NULL; q = q->next) {
+    u8_t *data = (u8_t *)q->payload;
+    u16_t len = q->len;
+
+    while (len > 0) {
+      mqtt_connection_status_t res = MQTT_CONNECT_ACCEPTED;
+      u16_t n = 1;
+
+      switch (client->rx_state) {
+        case MQTT_RX_STATE_TYPE:
+          client->rx_type = *data;
+          client->rx_rem_len = 0;
+          client->rx_len_bytes = 0;
+          client->rx_state = MQTT_RX_STATE_REM_LEN;
+          break;
+        case MQTT_RX_STATE_REM_LEN:
+          /* All bytes of remaining length but the last have 0x80 set */
+          client->rx_rem_len |= (u32_t)(*data & 0x7f) << (client->rx_len_bytes * 7);
+          client->rx_len_bytes++;
+          if ((*data & 0x80) == 0) {
+            res = mqtt_message_start(client);
+          } else if (client->rx_len_bytes >= 4) {
+            LWIP_DEBUGF(MQTT_DEBUG_WARN, ("mqtt_parse_incoming: Remaining length field too long\n"));
+            res = MQTT_CONNECT_DISCONNECTED;
           }
-        }
-      }
-    } else {
-      /* Fixed header has been parsed, parse variable header */
-      u16_t cpy_len, buffer_space;
-      u8_t *var_hdr_payload;
-      mqtt_connection_status_t res;
-
-      /* Allow to copy the lesser one of available length in input data or bytes remaining in message */
-      cpy_len = (u16_t)LWIP_MIN((u16_t)(p->tot_len - in_offset), msg_rem_len);
-
-      /* Limit to available space in buffer */
-      buffer_space = MQTT_VAR_HEADER_BUFFER_LEN - fixed_hdr_len;
-      if (cpy_len > buffer_space) {
-        cpy_len = buffer_space;
-      }
-      /* Adjust cpy_len to ensure zero-copy operation for remaining parts of current message */
-      if (client->msg_idx >= MQTT_VAR_HEADER_BUFFER_LEN) {
-        if (cpy_len > (p->len - in_offset))
-          cpy_len = p->len - in_offset;
+          break;
+        case MQTT_RX_STATE_VAR_HDR:
+          /* Keep what fits in buffer, messages handled here only need the first few bytes */
+          n = (u16_t)LWIP_MIN(len, client->rx_rem_len);
+          if (client->rx_idx < MQTT_VAR_HEADER_BUFFER_LEN) {
+            u16_t cpy_len = (u16_t)LWIP_MIN(n, MQTT_VAR_HEADER_BUFFER_LEN - client->rx_idx);
+            MEMCPY(&client->rx_buffer[client->rx_idx], data, cpy_len);
+            client->rx_idx = (u16_t)(client->rx_idx + cpy_len);
+          }
+          client->rx_rem_len -= n;
+          if (client->rx_rem_len == 0) {
+            client->rx_state = MQTT_RX_STATE_TYPE;
+            res = mqtt_message_received(client, client->rx_idx, client->rx_buffer);
+          }
+          break;
+        case MQTT_RX_STATE_TOPIC_LEN:
+        case MQTT_RX_STATE_PKT_ID:
+          client->rx_buffer[client->rx_idx++] = *data;
+          client->rx_rem_len--;
+          if (client->rx_idx == 2) {
+            res = mqtt_incoming_publish_u16(client);
+          }
+          break;
+        case MQTT_RX_STATE_TOPIC:
+          n = mqtt_incoming_publish_topic_data(client, data, len);
+          break;
+        case MQTT_RX_STATE_PAYLOAD:
+          n = (u16_t)LWIP_MIN(len, client->rx_rem_len);
+          client->rx_rem_len -= n;
+          if (!client->rx_skip && (client->data_cb != NULL)) {
+            client->data_cb(client->inpub_arg, data, n, client->rx_rem_len == 0 ? MQTT_DATA_FLAG_LAST : 0);
+          }
+          if (client->rx_rem_len == 0) {
+            mqtt_incoming_publish_done(client);
+          }
+          break;
+        default:
+          LWIP_ASSERT("mqtt_parse_incoming: invalid state", 0);
+          return MQTT_CONNECT_DISCONNECTED;
       }
-      var_hdr_payload = (u8_t*)pbuf_get_contiguous(p, client->rx_buffer + fixed_hdr_len,
-                                                   buffer_space, cpy_len, in_offset);
-
-      /* Advance get and put indexes  */
-      client->msg_idx += cpy_len;
-      in_offset += cpy_len;
-      msg_rem_len -= cpy_len;
-
-      LWIP_DEBUGF(MQTT_DEBUG_TRACE, ("mqtt_parse_incoming: msg_idx: %"U32_F", cpy_len: %"U16_F", remaining %"U32_F"\n", client->msg_idx, cpy_len, msg_rem_len));
-      /* Whole or partial message received */
-      res = mqtt_message_received(client, fixed_hdr_len, cpy_len, msg_rem_len, var_hdr_payload);
       if (res != MQTT_CONNECT_ACCEPTED) {
         return res;
       }
-      if (msg_rem_len == 0) {
-        /* Reset parser state */
-        client->msg_idx = 0;
-        /* msg_tot_len = 0; */
-        fixed_hdr_len = 0;
-      }
+      data += n;
+      len = (u16_t)(len - n);
     }
   }
   return MQTT_CONNECT_ACCEPTED;
@@ -987,6 +1272,10 @@ mqtt_tcp_sent_cb(void *arg, struct altcp_pcb *tpcb, u16_t len)
   LWIP_UNUSED_ARG(tpcb);
   LWIP_UNUSED_ARG(len);
 
+#if MQTT_OUTPUT_REF_MAX > 0
+  mqtt_output_acked(&client->output, len);
+#endif /* MQTT_OUTPUT_REF_MAX > 0 */
+
   if (client->conn_state == MQTT_CONNECTED) {
     struct mqtt_request_t *r;
 
@@ -1058,7 +1347,7 @@ mqtt_tcp_connect_cb(void *arg, struct altcp_pcb *tpcb, err_t err)
   }
 
   /* Initiate receiver state */
-  client->msg_idx = 0;
+  client->rx_state = MQTT_RX_STATE_TYPE;
 
   /* Setup TCP callbacks */
   altcp_recv(tpcb, mqtt_tcp_recv_cb);
@@ -1086,12 +1375,12 @@ mqtt_tcp_connect_cb(void *arg, struct altcp_pcb *tpcb, err_t err)
 
 
 /**
- * @ingroup mqtt
- * MQTT publish function.
+ * Queue a publish message
  * @param client MQTT client
  * @param topic Publish topic string
- * @param payload Data to publish (NULL is allowed)
- * @param payload_length Length of payload (0 is allowed)
+ * @param payload Data to copy into output buffer (NULL is allowed)
+ * @param payload_ref pbuf chain to send by reference instead of payload (NULL is allowed)
+ * @param payload_length Length of payload or payload_ref
  * @param qos Quality of service, 0 1 or 2
  * @param retain MQTT retain flag
  * @param cb Callback to call when publish is complete or has timed out
@@ -1100,9 +1389,9 @@ mqtt_tcp_connect_cb(void *arg, struct altcp_pcb *tpcb, err_t err)
  *         ERR_CONN if client is disconnected
  *         ERR_MEM if short on memory
  */
-err_t
-mqtt_publish(mqtt_client_t *client, const char *topic, const void *payload, u16_t payload_length, u8_t qos, u8_t retain,
-             mqtt_request_cb_t cb, void *arg)
+static err_t
+mqtt_publish_msg(mqtt_client_t *client, const char *topic, const void *payload, struct pbuf *payload_ref,
+                 u16_t payload_length, u8_t qos, u8_t retain, mqtt_request_cb_t cb, void *arg)
 {
   struct mqtt_request_t *r;
   u16_t pkt_id;
@@ -1110,6 +1399,7 @@ mqtt_publish(mqtt_client_t *client, const char *topic, const void *payload, u16_
   size_t total_len;
   u16_t topic_len;
   u16_t remaining_length;
+  u8_t space;
 
   LWIP_ASSERT_CORE_LOCKED();
   LWIP_ASSERT("mqtt_publish: client != NULL", client);
@@ -1139,7 +1429,15 @@ mqtt_publish(mqtt_client_t *client, const char *topic, const void *payload, u16_
     return ERR_MEM;
   }
 
-  if (mqtt_output_check_space(&client->output, remaining_length) == 0) {
+#if MQTT_OUTPUT_REF_MAX > 0
+  if (payload_ref != NULL) {
+    space = mqtt_output_check_space_ref(&client->output, remaining_length, payload_length);
+  } else
+#endif /* MQTT_OUTPUT_REF_MAX > 0 */
+  {
+    space = mqtt_output_check_space(&client->output, remaining_length);
+  }
+  if (space == 0) {
     mqtt_delete_request(r);
     return ERR_MEM;
   }
@@ -1154,6 +1452,20 @@ mqtt_publish(mqtt_client_t *client, const char *topic, const void *payload, u16_
     mqtt_output_append_u16(&client->output, pkt_id);
   }
 
+#if MQTT_OUTPUT_REF_MAX > 0
+  if (payload_ref != NULL) {
+    /* Payload goes out right after the bytes appended so far */
+    struct mqtt_output_ref_t *ref = mqtt_output_ref_at(&client->output, client->output.ref_cnt);
+    pbuf_ref(payload_ref);
+    ref->p = payload_ref;
+    ref->ring_mark = client->output.ring_in;
+    ref->stream_end = 0;
+    ref->written = 0;
+    client->output.ref_cnt++;
+  } else
+#else /* MQTT_OUTPUT_REF_MAX > 0 */
+  LWIP_UNUSED_ARG(payload_ref);
+#endif /* MQTT_OUTPUT_REF_MAX > 0 */
   /* Append optional publish payload */
   if ((payload != NULL) && (payload_length > 0)) {
     mqtt_output_append_buf(&client->output, payload, payload_length);
@@ -1164,6 +1476,59 @@ mqtt_publish(mqtt_client_t *client, const char *topic, const void *payload, u16_
   return ERR_OK;
 }
 
+/**
+ * @ingroup mqtt
+ * MQTT publish function.
+ * @param client MQTT client
+ * @param topic Publish topic string
+ * @param payload Data to publish (NULL is allowed)
+ * @param payload_length Length of payload (0 is allowed)
+ * @param qos Quality of service, 0 1 or 2
+ * @param retain MQTT retain flag
+ * @param cb Callback to call when publish is complete or has timed out
+ * @param arg User supplied argument to publish callback
+ * @return ERR_OK if successful
+ *         ERR_CONN if client is disconnected
+ *         ERR_MEM if short on memory
+ */
+err_t
+mqtt_publish(mqtt_client_t *client, const char *topic, const void *payload, u16_t payload_length, u8_t qos, u8_t retain,
+             mqtt_request_cb_t cb, void *arg)
+{
+  return mqtt_publish_msg(client, topic, payload, NULL, payload_length, qos, retain, cb, arg);
+}
+
+#if MQTT_OUTPUT_REF_MAX > 0
+/**
+ * @ingroup mqtt
+ * MQTT publish function sending the payload by reference.
+ * Only fixed header, topic and packet identifier are copied into the output ring buffer,
+ * the payload is handed to TCP without copying it. This avoids copying large payloads
+ * twice and does not require MQTT_OUTPUT_RINGBUF_SIZE to be larger than the payload.
+ * The payload is referenced with pbuf_ref() and freed once TCP has acknowledged all of it
+ * or the connection is closed, so its memory must not be changed until then. Use a custom
+ * pbuf (pbuf_alloced_custom()) to be notified when the memory can be reused.
+ * With a TLS altcp layer the payload is still copied once by the encryption.
+ * @param client MQTT client
+ * @param topic Publish topic string
+ * @param payload pbuf chain with data to publish, tot_len must not be 0
+ * @param qos Quality of service, 0 1 or 2
+ * @param retain MQTT retain flag
+ * @param cb Callback to call when publish is complete or has timed out
+ * @param arg User supplied argument to publish callback
+ * @return ERR_OK if successful
+ *         ERR_CONN if client is disconnected
+ *         ERR_MEM if short on memory or MQTT_OUTPUT_REF_MAX payloads are already queued
+ */
+err_t
+mqtt_publish_ref(mqtt_client_t *client, const char *topic, struct pbuf *payload, u8_t qos, u8_t retain,
+                 mqtt_request_cb_t cb, void *arg)
+{
+  LWIP_ERROR("mqtt_publish_ref: payload != NULL", (payload != NULL) && (payload->tot_len > 0), return ERR_ARG);
+  return mqtt_publish_msg(client, topic, NULL, payload, payload->tot_len, qos, retain, cb, arg);
+}
+#endif /* MQTT_OUTPUT_REF_MAX > 0 */
+
 
 /**
  * @ingroup mqtt
@@ -1252,6 +1617,24 @@ mqtt_set_inpub_callback(mqtt_client_t *client, mqtt_incoming_publish_cb_t pub_cb
   client->inpub_arg = arg;
 }
 
+/**
+ * @ingroup mqtt
+ * Set callback receiving the topic of incoming publish in fragments.
+ * Fragments are passed directly from received data, so topics longer than
+ * MQTT_VAR_HEADER_BUFFER_LEN - 1 can be received; these are reported to the
+ * incoming publish callback with topic NULL. Without topic callback such
+ * publish messages are dropped.
+ * @param client MQTT client
+ * @param topic_cb Callback invoked before incoming publish callback, NULL to disable
+ */
+void
+mqtt_set_inpub_topic_callback(mqtt_client_t *client, mqtt_incoming_topic_cb_t topic_cb)
+{
+  LWIP_ASSERT_CORE_LOCKED();
+  LWIP_ASSERT("mqtt_set_inpub_topic_callback: client != NULL", client != NULL);
+  client->topic_cb = topic_cb;
+}
+
 /**
  * @ingroup mqtt
  * Create a new MQTT client instance
@@ -1299,6 +1682,7 @@ mqtt_client_connect(mqtt_client_t *client, const ip_addr_t *ip_addr, u16_t port,
   u16_t client_user_len = 0, client_pass_len = 0;
   mqtt_incoming_data_cb_t data_cb;
   mqtt_incoming_publish_cb_t pub_cb;
+  mqtt_incoming_topic_cb_t topic_cb;
   void *inpub_arg;
 
   LWIP_ASSERT_CORE_LOCKED();
@@ -1315,10 +1699,12 @@ mqtt_client_connect(mqtt_client_t *client, const ip_addr_t *ip_addr, u16_t port,
   /* Wipe clean, but keep callbacks */
   data_cb = client->data_cb;
   pub_cb = client->pub_cb;
+  topic_cb = client->topic_cb;
   inpub_arg = client->inpub_arg;
   memset(client, 0, sizeof(mqtt_client_t));
   client->data_cb = data_cb;
   client->pub_cb = pub_cb;
+  client->topic_cb = topic_cb;
   client->inpub_arg = inpub_arg;
 
   client->connect_arg = arg;
@@ -155,6 +155,12 @@ PACK_STRUCT_END
 #if (LWIP_TCP && (TCP_SND_QUEUELEN > 0xffff))
 #error "If you want to use TCP, TCP_SND_QUEUELEN must fit in an u16_t, so, you have to reduce it in your lwipopts.h"
 #endif
+#if (LWIP_TCP && (LWIP_TCP_PCB_HASH_SIZE & (LWIP_TCP_PCB_HASH_SIZE - 1)))
+#error "LWIP_TCP_PCB_HASH_SIZE must be a power of 2"
+#endif
+#if (LWIP_UDP && (LWIP_UDP_PCB_HASH_SIZE & (LWIP_UDP_PCB_HASH_SIZE - 1)))
+#error "LWIP_UDP_PCB_HASH_SIZE must be a power of 2"
+#endif
 #if (LWIP_TCP && (TCP_SND_QUEUELEN < 2))
 #error "TCP_SND_QUEUELEN must be at least 2 for no-copy TCP writes to work"
 #endif
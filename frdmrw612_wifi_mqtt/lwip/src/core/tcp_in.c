@@ -68,6 +68,13 @@
 /** Initial CWND calculation as defined RFC 2581 */
 #define LWIP_TCP_CALC_INITIAL_CWND(mss) ((tcpwnd_size_t)LWIP_MIN((4U * (mss)), LWIP_MAX((2U * (mss)), 4380U)))
 
+/** Link of the active PCBs searched by tcp_input(): the bucket chain or the whole list */
+#if LWIP_TCP_PCB_HASH_SIZE
+#define TCP_ACTIVE_NEXT(pcb) ((pcb)->hash_next)
+#else /* LWIP_TCP_PCB_HASH_SIZE */
+#define TCP_ACTIVE_NEXT(pcb) ((pcb)->next)
+#endif /* LWIP_TCP_PCB_HASH_SIZE */
+
 /* These variables are global to all functions involved in the input
    processing of TCP segments. They are set by the tcp_input()
    function. */
@@ -118,6 +125,7 @@ void
 tcp_input(struct pbuf *p, struct netif *inp)
 {
   struct tcp_pcb *pcb, *prev;
+  struct tcp_pcb **active_pcbs;
   struct tcp_pcb_listen *lpcb;
 #if SO_REUSE
   struct tcp_pcb *lpcb_prev = NULL;
@@ -246,8 +254,13 @@ tcp_input(struct pbuf *p, struct netif *inp)
   /* Demultiplex an incoming segment. First, we check if it is destined
      for an active connection. */
   prev = NULL;
+#if LWIP_TCP_PCB_HASH_SIZE
+  active_pcbs = tcp_active_pcbs_bucket(tcphdr->dest, tcphdr->src, ip_current_src_addr());
+#else /* LWIP_TCP_PCB_HASH_SIZE */
+  active_pcbs = &tcp_active_pcbs;
+#endif /* LWIP_TCP_PCB_HASH_SIZE */
 
-  for (pcb = tcp_active_pcbs; pcb != NULL; pcb = pcb->next) {
+  for (pcb = *active_pcbs; pcb != NULL; pcb = TCP_ACTIVE_NEXT(pcb)) {
     LWIP_ASSERT("tcp_input: active pcb->state != CLOSED", pcb->state != CLOSED);
     LWIP_ASSERT("tcp_input: active pcb->state != TIME-WAIT", pcb->state != TIME_WAIT);
     LWIP_ASSERT("tcp_input: active pcb->state != LISTEN", pcb->state != LISTEN);
@@ -263,18 +276,18 @@ tcp_input(struct pbuf *p, struct netif *inp)
         pcb->local_port == tcphdr->dest &&
         ip_addr_eq(&pcb->remote_ip, ip_current_src_addr()) &&
         ip_addr_eq(&pcb->local_ip, ip_current_dest_addr())) {
-      /* Move this PCB to the front of the list so that subsequent
-         lookups will be faster (we exploit locality in TCP segment
-         arrivals). */
-      LWIP_ASSERT("tcp_input: pcb->next != pcb (before cache)", pcb->next != pcb);
+      /* Move this PCB to the front of the list (or of its bucket) so that
+         subsequent lookups will be faster (we exploit locality in TCP
+         segment arrivals). */
+      LWIP_ASSERT("tcp_input: pcb->next != pcb (before cache)", TCP_ACTIVE_NEXT(pcb) != pcb);
       if (prev != NULL) {
-        prev->next = pcb->next;
-        pcb->next = tcp_active_pcbs;
-        tcp_active_pcbs = pcb;
+        TCP_ACTIVE_NEXT(prev) = TCP_ACTIVE_NEXT(pcb);
+        TCP_ACTIVE_NEXT(pcb) = *active_pcbs;
+        *active_pcbs = pcb;
       } else {
         TCP_STATS_INC(tcp.cachehit);
       }
-      LWIP_ASSERT("tcp_input: pcb->next != pcb (after cache)", pcb->next != pcb);
+      LWIP_ASSERT("tcp_input: pcb->next != pcb (after cache)", TCP_ACTIVE_NEXT(pcb) != pcb);
       break;
     }
     prev = pcb;
@@ -40,6 +40,7 @@
 #include "lwip/apps/mqtt_opts.h"
 #include "lwip/err.h"
 #include "lwip/ip_addr.h"
+#include "lwip/pbuf.h"
 #include "lwip/prot/iana.h"
 
 #ifdef __cplusplus
@@ -157,12 +158,28 @@ typedef void (*mqtt_incoming_data_cb_t)(void *arg, const u8_t *data, u16_t len,
  * arrives to a subscribed topic @see mqtt_subscribe
  *
  * @param arg Additional argument to pass to the callback function
- * @param topic Zero terminated Topic text string, topic may not be referenced after callback return
+ * @param topic Zero terminated Topic text string, topic may not be referenced after callback return,
+ *              NULL if the topic was longer than MQTT_VAR_HEADER_BUFFER_LEN - 1 and has been passed
+ *              to the topic callback only
  * @param tot_len Total length of publish data, if set to 0 (no publish payload) data callback will not be invoked
  */
 typedef void (*mqtt_incoming_publish_cb_t)(void *arg, const char *topic, u32_t tot_len);
 
 
+/**
+ * @ingroup mqtt
+ * Function prototype for MQTT incoming publish topic callback function. Called with the topic
+ * of an incoming publish in one or more fragments, before the incoming publish callback.
+ * @see mqtt_set_inpub_topic_callback
+ *
+ * @param arg Additional argument to pass to the callback function
+ * @param topic Topic fragment, not zero terminated, may not be referenced after callback return
+ * @param len Length of topic fragment
+ * @param flags MQTT_DATA_FLAG_LAST set when this call contains the last part of the topic
+ */
+typedef void (*mqtt_incoming_topic_cb_t)(void *arg, const char *topic, u16_t len, u8_t flags);
+
+
 /**
  * @ingroup mqtt
  * Function prototype for mqtt request callback. Called when a subscribe, unsubscribe
@@ -187,6 +204,7 @@ u8_t mqtt_client_is_connected(mqtt_client_t *client);
 
 void mqtt_set_inpub_callback(mqtt_client_t *client, mqtt_incoming_publish_cb_t pub_cb,
                              mqtt_incoming_data_cb_t data_cb, void *arg);
+void mqtt_set_inpub_topic_callback(mqtt_client_t *client, mqtt_incoming_topic_cb_t topic_cb);
 
 err_t mqtt_sub_unsub(mqtt_client_t *client, const char *topic, u8_t qos, mqtt_request_cb_t cb, void *arg, u8_t sub);
 
@@ -200,6 +218,11 @@ err_t mqtt_sub_unsub(mqtt_client_t *client, const char *topic, u8_t qos, mqtt_re
 err_t mqtt_publish(mqtt_client_t *client, const char *topic, const void *payload, u16_t payload_length, u8_t qos, u8_t retain,
                                     mqtt_request_cb_t cb, void *arg);
 
+#if MQTT_OUTPUT_REF_MAX > 0
+err_t mqtt_publish_ref(mqtt_client_t *client, const char *topic, struct pbuf *payload, u8_t qos, u8_t retain,
+                       mqtt_request_cb_t cb, void *arg);
+#endif /* MQTT_OUTPUT_REF_MAX > 0 */
+
 #ifdef __cplusplus
 }
 #endif
@@ -121,6 +121,22 @@
 #if !defined LWIP_TIMERS_CUSTOM || defined __DOXYGEN__
 #define LWIP_TIMERS_CUSTOM              0
 #endif
+
+/**
+ * LWIP_TIMERS_WHEEL==1: Keep the timeouts in a hierarchical timer wheel
+ * instead of a sorted list. sys_timeout() and sys_untimeout() then take
+ * constant time regardless of the number of pending timeouts and
+ * sys_check_timeouts() skips idle periods without walking every millisecond.
+ * sys_timeouts_sleeptime() may return less than the time to the next timeout:
+ * the time when later timeouts are moved to finer slots of the wheel.
+ * Timeouts are called in the same order as with the list.
+ * Costs 320 pointers for the wheel slots, one pointer per two
+ * MEMP_NUM_SYS_TIMEOUT for sys_untimeout() and 16 bytes per timeout.
+ * Has no effect with LWIP_TIMERS_CUSTOM.
+ */
+#if !defined LWIP_TIMERS_WHEEL || defined __DOXYGEN__
+#define LWIP_TIMERS_WHEEL               0
+#endif
 /**
  * @}
  */
@@ -1262,6 +1278,16 @@
 #if !defined LWIP_NETBUF_RECVINFO || defined __DOXYGEN__
 #define LWIP_NETBUF_RECVINFO            0
 #endif
+
+/**
+ * LWIP_UDP_PCB_HASH_SIZE: When this is > 0, incoming datagrams are matched
+ * against the udp pcbs bound to the same local port only, found through a
+ * hash table of this many buckets, instead of walking the list of all udp
+ * pcbs. Must be a power of 2. Costs one pointer per bucket and per pcb.
+ */
+#if !defined LWIP_UDP_PCB_HASH_SIZE || defined __DOXYGEN__
+#define LWIP_UDP_PCB_HASH_SIZE          0
+#endif
 /**
  * @}
  */
@@ -1550,6 +1576,17 @@
 #define LWIP_TCP_PCB_NUM_EXT_ARGS       0
 #endif
 
+/**
+ * LWIP_TCP_PCB_HASH_SIZE: When this is > 0, incoming segments are matched
+ * against the active tcp pcbs with the same ports and remote address only,
+ * found through a hash table of this many buckets, instead of walking the list
+ * of all active pcbs. Listen and TIME-WAIT pcbs are still searched linearly.
+ * Must be a power of 2. Costs one pointer per bucket and per pcb.
+ */
+#if !defined LWIP_TCP_PCB_HASH_SIZE || defined __DOXYGEN__
+#define LWIP_TCP_PCB_HASH_SIZE          0
+#endif
+
 /** LWIP_ALTCP==1: enable the altcp API.
  * altcp is an abstraction layer that prevents applications linking against the
  * tcp.h functions but provides the same functionality. It is used to e.g. add
@@ -2195,6 +2232,23 @@
 #if !defined LWIP_SOCKET_POLL || defined __DOXYGEN__
 #define LWIP_SOCKET_POLL                1
 #endif
+
+/**
+ * LWIP_SOCKET_MMSG==1: enable recvmmsg()/sendmmsg() for UDP and RAW sockets.
+ * sendmmsg() passes all datagrams to the tcpip thread in one call instead of
+ * one per datagram.
+ */
+#if !defined LWIP_SOCKET_MMSG || defined __DOXYGEN__
+#define LWIP_SOCKET_MMSG                0
+#endif
+
+/**
+ * LWIP_SOCKET_MMSG_MAX: maximum number of datagrams handled by one
+ * recvmmsg()/sendmmsg() call. sendmmsg() keeps that many netbufs on the stack.
+ */
+#if !defined LWIP_SOCKET_MMSG_MAX || defined __DOXYGEN__
+#define LWIP_SOCKET_MMSG_MAX            8
+#endif
 /**
  * @}
  */
@@ -2985,6 +3039,29 @@
 #define LWIP_HOOK_TCP_OUT_ADD_TCPOPTS(p, hdr, pcb, opts)
 #endif
 
+/**
+ * LWIP_HOOK_TCP_RCV_WND_LIMIT:
+ * Hook for limiting the receive window announced to the remote host, e.g. when
+ * the buffers for incoming segments run short.
+ * Signature:\code{.c}
+ * u32_t my_hook_tcp_rcv_wnd_limit(const struct tcp_pcb *pcb);
+ * \endcode
+ * Arguments:
+ * - pcb: tcp_pcb that updates its announced window
+ * Return value:
+ * - maximum window to announce, the window is not limited if it is >= pcb->rcv_wnd
+ *
+ * The limit only holds back opening of the window, data already announced is
+ * still accepted. A limit below TCP_WND_UPDATE_THRESHOLD stalls the connection:
+ * tcp_recved() never sends the update reopening a closed window then.
+ *
+ * ATTENTION: don't call any tcp api functions that might change tcp state (pcb
+ * state or any pcb lists) from this callback!
+ */
+#ifdef __DOXYGEN__
+#define LWIP_HOOK_TCP_RCV_WND_LIMIT(pcb)
+#endif
+
 /**
  * LWIP_HOOK_IP4_INPUT(pbuf, input_netif):
  * Called from ip_input() (IPv4)
@@ -341,6 +341,19 @@ extern struct tcp_pcb *tcp_active_pcbs;  /* List of all TCP PCBs that are in a
               data. */
 extern struct tcp_pcb *tcp_tw_pcbs;      /* List of all TCP PCBs in TIME-WAIT. */
 
+#if LWIP_TCP_PCB_HASH_SIZE
+/* The PCBs of tcp_active_pcbs, chained by hash_next in buckets by tcp_active_pcbs_bucket() */
+extern struct tcp_pcb *tcp_active_pcbs_hash[LWIP_TCP_PCB_HASH_SIZE];
+struct tcp_pcb **tcp_active_pcbs_bucket(u16_t local_port, u16_t remote_port, const ip_addr_t *remote_ip);
+void tcp_active_pcbs_hash_add(struct tcp_pcb *pcb);
+void tcp_active_pcbs_hash_remove(struct tcp_pcb *pcb);
+#define TCP_ACTIVE_HASH_ADD(npcb) tcp_active_pcbs_hash_add(npcb)
+#define TCP_ACTIVE_HASH_RMV(npcb) tcp_active_pcbs_hash_remove(npcb)
+#else /* LWIP_TCP_PCB_HASH_SIZE */
+#define TCP_ACTIVE_HASH_ADD(npcb)
+#define TCP_ACTIVE_HASH_RMV(npcb)
+#endif /* LWIP_TCP_PCB_HASH_SIZE */
+
 #define NUM_TCP_PCB_LISTS_NO_TIME_WAIT  3
 #define NUM_TCP_PCB_LISTS               4
 extern struct tcp_pcb ** const tcp_pcb_lists[NUM_TCP_PCB_LISTS];
@@ -422,11 +435,13 @@ extern struct tcp_pcb ** const tcp_pcb_lists[NUM_TCP_PCB_LISTS];
 #define TCP_REG_ACTIVE(npcb)                       \
   do {                                             \
     TCP_REG(&tcp_active_pcbs, npcb);               \
+    TCP_ACTIVE_HASH_ADD(npcb);                     \
     tcp_active_pcbs_changed = 1;                   \
   } while (0)
 
 #define TCP_RMV_ACTIVE(npcb)                       \
   do {                                             \
+    TCP_ACTIVE_HASH_RMV(npcb);                     \
     TCP_RMV(&tcp_active_pcbs, npcb);               \
     tcp_active_pcbs_changed = 1;                   \
   } while (0)
@@ -249,6 +249,11 @@ struct tcp_pcb {
   /* ports are in host byte order */
   u16_t remote_port;
 
+#if LWIP_TCP_PCB_HASH_SIZE
+  /* next active pcb in the same bucket of tcp_active_pcbs_hash */
+  struct tcp_pcb *hash_next;
+#endif
+
   tcpflags_t flags;
 #define TF_ACK_DELAY   0x01U   /* Delayed ACK. */
 #define TF_ACK_NOW     0x02U   /* Immediate ACK. */
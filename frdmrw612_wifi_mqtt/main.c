@@ -175,7 +175,10 @@ static void main_task(void *arg)
     PRINTF(" MQTT client example\r\n");
     PRINTF("************************************************\r\n");
 
-	//init_flash_storage(CONNECTION_INFO_FILENAME);
+    if (init_flash_storage(CONNECTION_INFO_FILENAME) != 0)
+    {
+        PRINTF("[!] Flash init failed\r\n");
+    }
 
     /* Initialize Wi-Fi board */
     PRINTF("[i] Initializing Wi-Fi connection... \r\n");
@@ -196,6 +199,22 @@ static void main_task(void *arg)
 
     PRINTF("[i] Successfully initialized Wi-Fi module\r\n");
 
+    wifi_profile_t profile;
+
+    /* Try the saved networks, using cached BSSID, channel and PMK for fast reconnect */
+    if (join_saved_wifi_profile(CONNECTION_INFO_FILENAME, WIFI_NETWORK_LABEL, &profile) == 0)
+    {
+        PRINTF("[i] Connected to Wi-Fi\r\nssid: %s\r\n", profile.ssid);
+        PRINTF("[i] Time to connected: %u ms since boot\r\n",
+               (unsigned int)(xTaskGetTickCount() * portTICK_PERIOD_MS));
+
+        /* Once connected, start MQTT client */
+        mqtt_freertos_run_thread(netif_default);
+        vTaskDelete(NULL);
+    }
+
+    PRINTF("[i] No saved network available. Starting SoftAP for provisioning.\r\n");
+
     //ConnectTo();
     /// wait_dns
 
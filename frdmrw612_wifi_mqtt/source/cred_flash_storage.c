@@ -11,8 +11,37 @@
 #include "fsl_debug_console.h"
 #include "mflash_file.h"
 #include "wpl.h"
+#include "FreeRTOS.h"
+#include "task.h"
 
-#define FILE_HEADER "wifi_credentials:"
+/*
+ * The file holds magic followed by a sequence of TLV records (type, length, value). Each profile starts with
+ * CRED_TLV_PROFILE record followed by records of its fields, profiles are stored in order of their priority.
+ * Strings are stored without terminating zero. Records of unknown type are skipped.
+ */
+#define CRED_FILE_MAGIC "WCR1"
+#define CRED_MAGIC_LEN  (sizeof(CRED_FILE_MAGIC) - 1)
+
+#define CRED_TLV_PROFILE    0x01
+#define CRED_TLV_SSID       0x10
+#define CRED_TLV_PASSPHRASE 0x11
+#define CRED_TLV_SECURITY   0x12
+#define CRED_TLV_PMK        0x13
+#define CRED_TLV_BSSID      0x14
+#define CRED_TLV_CHANNEL    0x15
+
+#define CRED_TLV_HDR_LEN 2
+
+/* Maximum size of encoded profile */
+#define CRED_PROFILE_MAX_LEN                                                                                      \
+    (CRED_TLV_HDR_LEN + (CRED_TLV_HDR_LEN + WPL_WIFI_SSID_LENGTH) + (CRED_TLV_HDR_LEN + WPL_WIFI_PASSWORD_LENGTH) + \
+     (CRED_TLV_HDR_LEN + WIFI_SECURITY_LENGTH) + (CRED_TLV_HDR_LEN + WIFI_PMK_LENGTH) +                            \
+     (CRED_TLV_HDR_LEN + WIFI_BSSID_LENGTH) + (CRED_TLV_HDR_LEN + 1))
+
+#define CRED_FILE_MAX_LEN (CRED_MAGIC_LEN + WIFI_PROFILES_MAX * CRED_PROFILE_MAX_LEN)
+
+/* Buffer to encode the file to */
+static uint8_t s_cred_buf[CRED_FILE_MAX_LEN];
 
 static uint32_t save_file(char *filename, char *data, uint32_t data_len)
 {
@@ -39,7 +68,7 @@ static uint32_t save_file(char *filename, char *data, uint32_t data_len)
 uint32_t init_flash_storage(char *filename)
 {
     /* Flash structure */
-    mflash_file_t file_table[] = {{.path = filename, .max_size = 200}, {0}};
+    mflash_file_t file_table[] = {{.path = filename, .max_size = CRED_FILE_MAX_LEN}, {0}};
 
     if (mflash_init(file_table, 1) != kStatus_Success)
     {
@@ -50,8 +79,374 @@ uint32_t init_flash_storage(char *filename)
     return 0;
 }
 
+/* Maps the file and checks its magic, returns pointer to the TLV records */
+static const uint8_t *cred_file_map(char *filename, uint32_t *len)
+{
+    const uint8_t *buf;
+    uint32_t data_len = 0;
+
+    if (mflash_file_mmap(filename, &buf, &data_len) != kStatus_Success)
+    {
+        return NULL;
+    }
+
+    if ((data_len < CRED_MAGIC_LEN) || (memcmp(buf, CRED_FILE_MAGIC, CRED_MAGIC_LEN) != 0))
+    {
+        return NULL;
+    }
+
+    *len = data_len - CRED_MAGIC_LEN;
+    return buf + CRED_MAGIC_LEN;
+}
+
+/* Checks whether TLV record at given position lies within the buffer */
+static bool cred_tlv_valid(const uint8_t *buf, uint32_t len, uint32_t pos)
+{
+    return (pos + CRED_TLV_HDR_LEN <= len) && (pos + CRED_TLV_HDR_LEN + buf[pos + 1] <= len);
+}
+
+/* Finds TLV records of profile with given index, retrieves their position and total length */
+static bool cred_profile_find(const uint8_t *buf, uint32_t len, uint32_t index, uint32_t *ppos, uint32_t *plen)
+{
+    uint32_t pos   = 0;
+    uint32_t start = 0;
+    uint32_t count = 0;
+    bool found     = false;
+
+    for (; cred_tlv_valid(buf, len, pos); pos += CRED_TLV_HDR_LEN + buf[pos + 1])
+    {
+        if (buf[pos] == CRED_TLV_PROFILE)
+        {
+            /* Start of the next profile */
+            if (found)
+            {
+                break;
+            }
+
+            if (count++ == index)
+            {
+                found = true;
+                start = pos;
+            }
+        }
+    }
+
+    if (found)
+    {
+        *ppos = start;
+        *plen = pos - start;
+    }
+
+    return found;
+}
+
+/* Decodes profile from its TLV records */
+static bool cred_profile_decode(const uint8_t *buf, uint32_t len, wifi_profile_t *profile)
+{
+    (void)memset(profile, 0, sizeof(*profile));
+
+    /* Skip the profile start record */
+    for (uint32_t pos = CRED_TLV_HDR_LEN + buf[1]; pos < len; pos += CRED_TLV_HDR_LEN + buf[pos + 1])
+    {
+        const uint8_t *value = &buf[pos + CRED_TLV_HDR_LEN];
+        uint8_t value_len    = buf[pos + 1];
+
+        switch (buf[pos])
+        {
+            case CRED_TLV_SSID:
+                if (value_len > WPL_WIFI_SSID_LENGTH)
+                {
+                    return false;
+                }
+                (void)memcpy(profile->ssid, value, value_len);
+                break;
+
+            case CRED_TLV_PASSPHRASE:
+                if (value_len > WPL_WIFI_PASSWORD_LENGTH)
+                {
+                    return false;
+                }
+                (void)memcpy(profile->passphrase, value, value_len);
+                break;
+
+            case CRED_TLV_SECURITY:
+                if (value_len > WIFI_SECURITY_LENGTH)
+                {
+                    return false;
+                }
+                (void)memcpy(profile->security, value, value_len);
+                break;
+
+            case CRED_TLV_PMK:
+                if (value_len != WIFI_PMK_LENGTH)
+                {
+                    return false;
+                }
+                (void)memcpy(profile->pmk, value, value_len);
+                profile->pmk_valid = true;
+                break;
+
+            case CRED_TLV_BSSID:
+                if (value_len != WIFI_BSSID_LENGTH)
+                {
+                    return false;
+                }
+                (void)memcpy(profile->bssid, value, value_len);
+                profile->bssid_valid = true;
+                break;
+
+            case CRED_TLV_CHANNEL:
+                if (value_len != 1)
+                {
+                    return false;
+                }
+                profile->channel = value[0];
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    return profile->ssid[0] != '\0';
+}
+
+/* Checks whether encoded profile has given SSID */
+static bool cred_profile_ssid_match(const uint8_t *buf, uint32_t len, const char *ssid)
+{
+    for (uint32_t pos = CRED_TLV_HDR_LEN + buf[1]; pos < len; pos += CRED_TLV_HDR_LEN + buf[pos + 1])
+    {
+        if (buf[pos] == CRED_TLV_SSID)
+        {
+            return (buf[pos + 1] == strlen(ssid)) && (memcmp(&buf[pos + CRED_TLV_HDR_LEN], ssid, buf[pos + 1]) == 0);
+        }
+    }
+
+    return false;
+}
+
+/* Appends TLV record to the buffer, returns position past the record */
+static uint32_t cred_tlv_put(uint8_t *buf, uint32_t pos, uint8_t type, const void *value, uint32_t len)
+{
+    buf[pos]     = type;
+    buf[pos + 1] = (uint8_t)len;
+    if (len > 0u)
+    {
+        (void)memcpy(&buf[pos + CRED_TLV_HDR_LEN], value, len);
+    }
+
+    return pos + CRED_TLV_HDR_LEN + len;
+}
+
+/* Encodes profile to TLV records, returns their length */
+static uint32_t cred_profile_encode(uint8_t *buf, const wifi_profile_t *profile)
+{
+    uint32_t pos = 0;
+
+    pos = cred_tlv_put(buf, pos, CRED_TLV_PROFILE, NULL, 0);
+    pos = cred_tlv_put(buf, pos, CRED_TLV_SSID, profile->ssid, strlen(profile->ssid));
+    pos = cred_tlv_put(buf, pos, CRED_TLV_PASSPHRASE, profile->passphrase, strlen(profile->passphrase));
+    pos = cred_tlv_put(buf, pos, CRED_TLV_SECURITY, profile->security, strlen(profile->security));
+
+    if (profile->pmk_valid)
+    {
+        pos = cred_tlv_put(buf, pos, CRED_TLV_PMK, profile->pmk, WIFI_PMK_LENGTH);
+    }
+
+    if (profile->bssid_valid)
+    {
+        pos = cred_tlv_put(buf, pos, CRED_TLV_BSSID, profile->bssid, WIFI_BSSID_LENGTH);
+        pos = cred_tlv_put(buf, pos, CRED_TLV_CHANNEL, &profile->channel, 1);
+    }
+
+    return pos;
+}
+
+/* Checks whether string fits the buffer including terminating zero */
+static bool cred_str_valid(const char *str, uint32_t size)
+{
+    return memchr(str, '\0', size) != NULL;
+}
+
+uint32_t save_wifi_profile(char *filename, const wifi_profile_t *profile)
+{
+    const uint8_t *old_buf;
+    uint32_t old_len;
+    uint32_t len;
+    uint32_t pos;
+    uint32_t profile_len;
+    uint32_t count = 1;
+
+    if (filename == NULL || (strlen(filename) > 63) || (profile == NULL))
+    {
+        return 1;
+    }
+
+    if (!cred_str_valid(profile->ssid, sizeof(profile->ssid)) || (profile->ssid[0] == '\0') ||
+        !cred_str_valid(profile->passphrase, sizeof(profile->passphrase)) ||
+        !cred_str_valid(profile->security, sizeof(profile->security)))
+    {
+        PRINTF("[!] Invalid Wi-Fi profile.\r\n");
+        return 1;
+    }
+
+    /* The new profile goes first */
+    (void)memcpy(s_cred_buf, CRED_FILE_MAGIC, CRED_MAGIC_LEN);
+    len = CRED_MAGIC_LEN + cred_profile_encode(&s_cred_buf[CRED_MAGIC_LEN], profile);
+
+    /* Followed by the stored ones copied as they are, except for the previous version of the new one */
+    old_buf = cred_file_map(filename, &old_len);
+    for (uint32_t i = 0; (old_buf != NULL) && (count < WIFI_PROFILES_MAX) &&
+                         cred_profile_find(old_buf, old_len, i, &pos, &profile_len);
+         i++)
+    {
+        if (cred_profile_ssid_match(&old_buf[pos], profile_len, profile->ssid) ||
+            (len + profile_len > sizeof(s_cred_buf)))
+        {
+            continue;
+        }
+
+        (void)memcpy(&s_cred_buf[len], &old_buf[pos], profile_len);
+        len += profile_len;
+        count++;
+    }
+
+    return save_file(filename, (char *)s_cred_buf, len);
+}
+
+uint32_t get_saved_wifi_profile(char *filename, uint32_t index, wifi_profile_t *profile)
+{
+    const uint8_t *buf;
+    uint32_t len;
+    uint32_t pos;
+    uint32_t profile_len;
+
+    if (filename == NULL || (strlen(filename) > 63) || (profile == NULL))
+    {
+        return 1;
+    }
+
+    /* Decode directly from memory mapped file */
+    buf = cred_file_map(filename, &len);
+    if ((buf == NULL) || !cred_profile_find(buf, len, index, &pos, &profile_len))
+    {
+        return 1;
+    }
+
+    if (!cred_profile_decode(&buf[pos], profile_len, profile))
+    {
+        return 1;
+    }
+
+    return 0;
+}
+
+/* Adds network of the profile and joins it, optionally using the cached hints */
+static wpl_ret_t cred_profile_join(const wifi_profile_t *profile, char *label, bool use_hints)
+{
+    wpl_ret_t result;
+
+    if (use_hints)
+    {
+        result = WPL_AddNetworkWithHints(profile->ssid, profile->passphrase, label,
+                                         profile->bssid_valid ? profile->bssid : NULL,
+                                         profile->bssid_valid ? (int)profile->channel : 0,
+                                         profile->pmk_valid ? profile->pmk : NULL);
+    }
+    else
+    {
+        result = WPL_AddNetwork(profile->ssid, profile->passphrase, label);
+    }
+
+    if (result == WPLRET_SUCCESS)
+    {
+        result = WPL_Join(label);
+        if (result != WPLRET_SUCCESS)
+        {
+            (void)WPL_RemoveNetwork(label);
+        }
+    }
+
+    return result;
+}
+
+/* Updates profile with hints of the current connection, returns true if they have changed */
+static bool cred_profile_update_hints(wifi_profile_t *profile)
+{
+    uint8_t bssid[WIFI_BSSID_LENGTH];
+    uint8_t pmk[WIFI_PMK_LENGTH];
+    int channel;
+    bool pmk_valid;
+    bool changed;
+
+    if (WPL_GetNetworkHints(bssid, &channel, pmk, &pmk_valid) != WPLRET_SUCCESS)
+    {
+        return false;
+    }
+
+    changed = !profile->bssid_valid || (memcmp(profile->bssid, bssid, WIFI_BSSID_LENGTH) != 0) ||
+              (profile->channel != (uint8_t)channel) || (profile->pmk_valid != pmk_valid) ||
+              (pmk_valid && (memcmp(profile->pmk, pmk, WIFI_PMK_LENGTH) != 0));
+
+    (void)memcpy(profile->bssid, bssid, WIFI_BSSID_LENGTH);
+    profile->bssid_valid = true;
+    profile->channel     = (uint8_t)channel;
+    profile->pmk_valid   = pmk_valid;
+    if (pmk_valid)
+    {
+        (void)memcpy(profile->pmk, pmk, WIFI_PMK_LENGTH);
+    }
+
+    return changed;
+}
+
+uint32_t join_saved_wifi_profile(char *filename, char *label, wifi_profile_t *profile)
+{
+    for (uint32_t i = 0; get_saved_wifi_profile(filename, i, profile) == 0; i++)
+    {
+        TickType_t start = xTaskGetTickCount();
+        wpl_ret_t result = WPLRET_FAIL;
+
+        /* Single channel directed probe and cached PMK, the access point may have changed since though */
+        if (profile->bssid_valid || profile->pmk_valid)
+        {
+            result = cred_profile_join(profile, label, true);
+            if (result != WPLRET_SUCCESS)
+            {
+                PRINTF("[i] Fast reconnect to %s failed, scanning all channels.\r\n", profile->ssid);
+            }
+        }
+
+        if (result != WPLRET_SUCCESS)
+        {
+            result = cred_profile_join(profile, label, false);
+        }
+
+        if (result != WPLRET_SUCCESS)
+        {
+            PRINTF("[!] Cannot connect to Wi-Fi network %s\r\n", profile->ssid);
+            continue;
+        }
+
+        PRINTF("[i] Joined %s in %u ms\r\n", profile->ssid,
+               (unsigned int)((xTaskGetTickCount() - start) * portTICK_PERIOD_MS));
+
+        /* Keep the hints for the next boot, avoid the FLASH write if nothing has changed */
+        if (cred_profile_update_hints(profile) || (i != 0u))
+        {
+            (void)save_wifi_profile(filename, profile);
+        }
+
+        return 0;
+    }
+
+    return 1;
+}
+
 uint32_t save_wifi_credentials(char *filename, char *ssid, char *passphrase, char *security)
 {
+    wifi_profile_t profile;
+
     if (filename == NULL || (strlen(filename) > 63))
     {
         return 1;
@@ -77,83 +472,32 @@ uint32_t save_wifi_credentials(char *filename, char *ssid, char *passphrase, cha
         return 1;
     }
 
-    char credentials_buf[sizeof(FILE_HEADER) + WPL_WIFI_SSID_LENGTH + WPL_WIFI_PASSWORD_LENGTH + WIFI_SECURITY_LENGTH + 4];
-    uint32_t data_len;
-
-    strcpy(credentials_buf, FILE_HEADER);
-    strcat(credentials_buf, ssid);
-    strcat(credentials_buf, "\n");
-    strcat(credentials_buf, passphrase);
-    strcat(credentials_buf, "\n");
-    strcat(credentials_buf, security);
-    strcat(credentials_buf, "\n");
-
-    data_len = strlen(credentials_buf) + 1; // Need to also store \0
-
-    if (save_file(filename, credentials_buf, data_len))
-    {
-        return 1;
-    }
+    (void)memset(&profile, 0, sizeof(profile));
+    strcpy(profile.ssid, ssid);
+    strcpy(profile.passphrase, passphrase);
+    strcpy(profile.security, security);
 
-    return 0;
+    return save_wifi_profile(filename, &profile);
 }
 
 uint32_t get_saved_wifi_credentials(char *filename, char *ssid, char *passphrase, char *security)
 {
-    const uint8_t *credentials_buf;
-    uint32_t data_len = 0;
-    status_t status;
+    wifi_profile_t profile;
+
     ssid[0]       = '\0';
     passphrase[0] = '\0';
     security[0] = '\0';
 
-    if (filename == NULL || (strlen(filename) > 63))
+    if (get_saved_wifi_profile(filename, 0, &profile) != 0)
     {
         return 1;
     }
 
-    status = mflash_file_mmap(filename, &credentials_buf, &data_len);
-    if (status == kStatus_Success)
-    {
-        if ((data_len > sizeof(FILE_HEADER)) &&
-            (strncmp((char *)credentials_buf, FILE_HEADER, strlen(FILE_HEADER)) == 0))
-        {
-            credentials_buf += strlen(FILE_HEADER);
-            uint32_t pos = 0;
+    strcpy(ssid, profile.ssid);
+    strcpy(passphrase, profile.passphrase);
+    strcpy(security, profile.security);
 
-            while (*credentials_buf != '\n' && pos <= WPL_WIFI_SSID_LENGTH)
-            {
-                ssid[pos] = *credentials_buf;
-                credentials_buf++;
-                pos++;
-            };
-            ssid[pos] = '\0';
-            credentials_buf++;
-            pos = 0;
-
-            while (*credentials_buf != '\n' && pos <= WPL_WIFI_PASSWORD_LENGTH)
-            {
-                passphrase[pos] = *credentials_buf;
-                pos++;
-                credentials_buf++;
-            };
-            passphrase[pos] = '\0';
-            credentials_buf++;
-            pos = 0;
-            
-            while (*credentials_buf != '\n' && pos <= WIFI_SECURITY_LENGTH)
-            {
-                security[pos] = *credentials_buf;
-                pos++;
-                credentials_buf++;
-            };
-            security[pos] = '\0';
-            
-        }
-
-        return 0;
-    }
-    return 1;
+    return 0;
 }
 
 uint32_t reset_saved_wifi_credentials(char *filename)
@@ -162,5 +506,5 @@ uint32_t reset_saved_wifi_credentials(char *filename)
     {
         return 1;
     }
-    return save_file(filename, "", 1);
+    return save_file(filename, CRED_FILE_MAGIC, CRED_MAGIC_LEN);
 }
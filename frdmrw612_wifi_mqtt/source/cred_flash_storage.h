@@ -6,17 +6,78 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 
+#include "webconfig.h"
+#include "wpl.h"
+
 #ifndef CRED_FLASH_STORAGE_H
 #define CRED_FLASH_STORAGE_H
 
+/*! @brief Maximum number of stored network profiles, the least recently saved one is dropped when full. */
+#ifndef WIFI_PROFILES_MAX
+#define WIFI_PROFILES_MAX 4
+#endif
+
+/*! @brief Length of precomputed pairwise master key. */
+#define WIFI_PMK_LENGTH WPL_WIFI_PMK_LENGTH
+
+/*! @brief Length of BSSID. */
+#define WIFI_BSSID_LENGTH WPL_WIFI_BSSID_LENGTH
+
+/*! @brief Stored network profile. */
+typedef struct
+{
+    char ssid[WPL_WIFI_SSID_LENGTH + 1];
+    char passphrase[WPL_WIFI_PASSWORD_LENGTH + 1];
+    char security[WIFI_SECURITY_LENGTH + 1];
+    bool pmk_valid;                   /*!< pmk holds key derived from ssid and passphrase */
+    uint8_t pmk[WIFI_PMK_LENGTH];
+    bool bssid_valid;                 /*!< bssid and channel hold the last access point connected to */
+    uint8_t bssid[WIFI_BSSID_LENGTH];
+    uint8_t channel;
+} wifi_profile_t;
+
 uint32_t init_flash_storage(char *filename);
 
+/*!
+ * @brief Saves network profile as the one with the highest priority.
+ *
+ * Profile with the same SSID is replaced, other profiles keep their order.
+ */
+uint32_t save_wifi_profile(char *filename, const wifi_profile_t *profile);
+
+/*!
+ * @brief Reads network profile of given priority, 0 being the highest.
+ *
+ * @return 0 on success, 1 if there is no such profile
+ */
+uint32_t get_saved_wifi_profile(char *filename, uint32_t index, wifi_profile_t *profile);
+
+/*!
+ * @brief Joins the highest priority stored network that is available.
+ *
+ * Cached BSSID, channel and PMK of a profile are tried first to skip the full scan and the PMK derivation,
+ * falling back to a full scan. The joined profile is updated with the hints of the connection and becomes
+ * the highest priority one.
+ *
+ * @param profile  retrieves the joined profile
+ * @return 0 on success, 1 if none of the networks could be joined
+ */
+uint32_t join_saved_wifi_profile(char *filename, char *label, wifi_profile_t *profile);
+
+/*! @brief Saves credentials as the highest priority profile. */
 uint32_t save_wifi_credentials(char *filename, char *ssid, char *passphrase, char *security);
 
+/*!
+ * @brief Reads credentials of the highest priority profile.
+ *
+ * The buffers shall be sized for the maximum length of the respective string plus the terminating zero.
+ */
 uint32_t get_saved_wifi_credentials(char *filename, char *ssid, char *passphrase, char *security);
 
+/*! @brief Removes all stored profiles. */
 uint32_t reset_saved_wifi_credentials(char *filename);
 
 #endif
@@ -391,6 +391,12 @@ void sys_mark_tcpip_thread(void);
 #define TCP_WND (10 * TCP_MSS)
 #endif
 
+/**
+ * LWIP_PORT_TCP_WND_LIMIT==1: Limit the receive window of each TCP connection
+ * to its share of free PBUF_POOL buffers (lwip/port/tcp_wnd.c).
+ */
+#define LWIP_PORT_TCP_WND_LIMIT 1
+
 /**
  * Enable TCP_KEEPALIVE
  */
@@ -498,6 +504,45 @@ void sys_mark_tcpip_thread(void);
 
 #define LWIP_COMPAT_MUTEX_ALLOWED 1
 
+/*
+   --------------------------------------
+   ---------- Checksum options ----------
+   --------------------------------------
+*/
+/**
+ * LWIP_PORT_CHKSUM==1: Use optimized checksum routines of the port (lwip/port/chksum.c).
+ */
+#define LWIP_PORT_CHKSUM 1
+
+/**
+ * LWIP_CHECKSUM_ON_COPY==1: Calculate checksum when copying data from
+ * application buffers to pbufs.
+ */
+#define LWIP_CHECKSUM_ON_COPY 1
+
+/*
+   ----------------------------------
+   ---------- MQTT options ----------
+   ----------------------------------
+*/
+/**
+ * MQTT_REQ_MAX_IN_FLIGHT: Number of MQTT requests in flight, two are kept
+ * for subscriptions, the rest is the publish window of mqtt_freertos.c.
+ */
+#define MQTT_REQ_MAX_IN_FLIGHT 10
+
+/**
+ * MQTT_OUTPUT_RINGBUF_SIZE: Output ring buffer size, holds all publish
+ * messages of the window until TCP takes them.
+ */
+#define MQTT_OUTPUT_RINGBUF_SIZE 1024
+
+/**
+ * MQTT_OUTPUT_REF_MAX: Number of payloads mqtt_publish_ref() can keep
+ * referenced until TCP has acknowledged them.
+ */
+#define MQTT_OUTPUT_REF_MAX 4
+
 #if (LWIP_DNS || LWIP_IGMP || LWIP_IPV6) && !defined(LWIP_RAND)
 /* When using IGMP or IPv6, LWIP_RAND() needs to be defined to a random-function returning an u32_t random value*/
 #include "lwip/arch.h"
@@ -16,6 +16,7 @@
 #define CONFIG_FLASH_LOAD_OFFSET 0x0
 #define CONFIG_IMU_BUSY_POLL_COUNT 0
 #define DEBUG_CONSOLE_SYNCHRONIZATION_MODE 0
+#define MFLASH_FILE_LOG 1
 // #define SERIAL_MANAGER_NON_BLOCKING_MODE 0
 // #define CONFIG_STREAM_FLASH 0
 // #define LIB_JPEG_USE_HW_ACCEL 0
@@ -18,4 +18,16 @@
  */
 void mqtt_freertos_run_thread(struct netif *netif);
 
+/*!
+ * @brief Queues a message for publishing. Can be called from any task.
+ *
+ * @param topic    topic to publish to
+ * @param payload  message payload
+ * @param len      payload length
+ * @param qos      quality of service, 0, 1 or 2
+ * @param retain   MQTT retain flag
+ * @return ERR_OK when queued, ERR_MEM when the queue is full, ERR_VAL on invalid arguments
+ */
+err_t mqtt_freertos_publish(const char *topic, const void *payload, u16_t len, u8_t qos, u8_t retain);
+
 #endif /* MQTT_FREERTOS_H */
@@ -0,0 +1,76 @@
+/*
+ * Copyright 2025 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef MQTT_ROUTER_H
+#define MQTT_ROUTER_H
+
+#include "lwip/apps/mqtt.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Maximum number of routes (topic filters with handlers). */
+#ifndef MQTT_ROUTER_ROUTES_MAX
+#define MQTT_ROUTER_ROUTES_MAX 32
+#endif
+
+/*! @brief Maximum number of trie nodes, one per distinct topic filter level. */
+#ifndef MQTT_ROUTER_NODES_MAX
+#define MQTT_ROUTER_NODES_MAX 64
+#endif
+
+/*! @brief Size of the arena holding the text of topic filter levels. */
+#ifndef MQTT_ROUTER_LEVELS_SIZE
+#define MQTT_ROUTER_LEVELS_SIZE 512
+#endif
+
+/*! @brief Maximum number of routes a single incoming message is dispatched to. */
+#ifndef MQTT_ROUTER_MATCH_MAX
+#define MQTT_ROUTER_MATCH_MAX 4
+#endif
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*!
+ * @brief Clears all routes and installs the router as incoming publish callback of the client.
+ *
+ * Messages not matching any route are passed to the default callbacks, if given.
+ * Like the rest of the MQTT client API, the router must be used with the lwIP core locked.
+ *
+ * @param client   MQTT client
+ * @param pub_cb   default incoming publish callback, may be NULL
+ * @param data_cb  default incoming data callback, may be NULL
+ * @param arg      argument of the default callbacks
+ */
+void mqtt_router_init(mqtt_client_t *client,
+                      mqtt_incoming_publish_cb_t pub_cb,
+                      mqtt_incoming_data_cb_t data_cb,
+                      void *arg);
+
+/*!
+ * @brief Adds a route for a topic filter.
+ *
+ * The filter may contain '+' and '#' wildcards as in MQTT subscriptions. Incoming messages
+ * matching the filter are passed to the callbacks, the same way as with mqtt_set_inpub_callback().
+ * Adding a filter again replaces its callbacks.
+ *
+ * @param filter   topic filter
+ * @param pub_cb   incoming publish callback, may be NULL
+ * @param data_cb  incoming data callback, may be NULL
+ * @param arg      argument of the callbacks
+ * @return ERR_OK on success, ERR_ARG on invalid filter, ERR_MEM when the router is full
+ */
+err_t mqtt_router_add(const char *filter,
+                      mqtt_incoming_publish_cb_t pub_cb,
+                      mqtt_incoming_data_cb_t data_cb,
+                      void *arg);
+
+#endif /* MQTT_ROUTER_H */
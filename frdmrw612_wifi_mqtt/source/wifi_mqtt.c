@@ -179,9 +179,9 @@ static void main_task(void *arg)
 
     init_flash_storage(CONNECTION_INFO_FILENAME);
 
-	char ssid[WPL_WIFI_SSID_LENGTH];
-	char password[WPL_WIFI_PASSWORD_LENGTH];
-	char security[WIFI_SECURITY_LENGTH];
+	char ssid[WPL_WIFI_SSID_LENGTH + 1];
+	char password[WPL_WIFI_PASSWORD_LENGTH + 1];
+	char security[WIFI_SECURITY_LENGTH + 1];
 
 	result = get_saved_wifi_credentials(CONNECTION_INFO_FILENAME, ssid, password, security);
 
@@ -20,7 +20,7 @@
 
 #if defined(SDK_OS_FREE_RTOS)
 
-#include "stack_simple.h"
+#include "slist.h"
 
 /**
  *  The actual Memory Pool data structure.
@@ -30,14 +30,30 @@
 typedef struct MemPool_t_
 {
     /**
-     *  We need a lock to make this thread safe.
+     *  Head of the free block list. Updated with exclusive load/store so
+     *  no lock is needed and allocation is safe from ISR context.
      */
-    OSA_MUTEX_HANDLE_DEFINE(Lock);
+    SlNode_t *volatile Head;
 
     /**
-     *  Memory blocks are stored on a stack.
+     *  How many blocks are currently free.
      */
-    Stack_t Stack;
+    volatile int Count;
+
+    /**
+     *  How many blocks the pool was created with.
+     */
+    int Total;
+
+    /**
+     *  Largest number of blocks ever in use at the same time.
+     */
+    volatile int HighWater;
+
+    /**
+     *  How many allocations failed because the pool was empty.
+     */
+    volatile uint32_t AllocFail;
 
     /**
      *  Save the item size for additions.
@@ -53,7 +69,6 @@ typedef struct MemPool_t_
      *  The begining of the actual memory pool itself.
      */
     unsigned char Buffer[1];
-
 } MemPool_t;
 
 #elif defined(FSL_RTOS_THREADX)
@@ -77,7 +92,7 @@ MemoryPool_t OSA_MemoryPoolCreate(
     MemPool_t *MemPool, int ItemSize, void *PreallocatedMemory, int PreallocatedMemorySize, int Alignment);
 
 /**Get a memory buffer from the pool.
- * Note that this can block, and cannnot be used from ISR context.
+ * Note that this never blocks and can be used from ISR context.
  *
  *\param[in] pool A handle to a MemoryPool.
  *\return A pointer or NULL on failure.
@@ -86,7 +101,7 @@ void *OSA_MemoryPoolAllocate(MemoryPool_t pool);
 
 /**free a memory buffer to the pool.
  *
- *  note This can block, and cannnot be used from ISR context.
+ *  note This never blocks and can be used from ISR context.
  *  note There is no check that the memory passed in is valid.
  *
  *\param[in] pool A handle to a MemoryPool.
@@ -94,4 +109,13 @@ void *OSA_MemoryPoolAllocate(MemoryPool_t pool);
  */
 void OSA_MemoryPoolFree(MemoryPool_t pool, void *memory);
 
+/**Get usage statistics of a memory pool.
+ *
+ *\param[in] pool A handle to a MemoryPool.
+ *\param[out] FreeCnt Number of blocks currently free, may be NULL.
+ *\param[out] HighWater Largest number of blocks in use at once, may be NULL.
+ *\param[out] AllocFail Number of failed allocations, may be NULL.
+ */
+void OSA_MemoryPoolGetStats(MemoryPool_t pool, int *FreeCnt, int *HighWater, uint32_t *AllocFail);
+
 #endif
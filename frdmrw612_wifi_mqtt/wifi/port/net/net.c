@@ -952,7 +952,21 @@ void net_configure_dns(struct net_ip_config *ip, unsigned int role)
 
 void net_stat(void)
 {
+#if CONFIG_WMM
+    t_u8 ac;
+    t_u32 wait_cnt;
+    t_u32 wait_ms;
+#endif
+
     stats_display();
+
+#if CONFIG_WMM
+    for (ac = 0; ac < MAX_AC_QUEUES; ac++)
+    {
+        wifi_wmm_get_tx_wait_stats(ac, &wait_cnt, &wait_ms);
+        LWIP_PLATFORM_DIAG(("TX wait AC%" U16_F ": blocked %" U32_F " times, %" U32_F " ms\n", (u16_t)ac, wait_cnt, wait_ms));
+    }
+#endif
 }
 
 #elif defined(__ZEPHYR__)
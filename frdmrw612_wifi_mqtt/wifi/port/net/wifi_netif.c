@@ -42,6 +42,9 @@
 /*------------------------------------------------------*/
 #include <netif_decl.h>
 #include <wlan.h>
+#if CONFIG_TX_RX_ZERO_COPY && CONFIG_IMU_RX_ZERO_COPY && defined(RW610)
+#include "lwip/memp.h"
+#endif
 
 /*------------------------------------------------------*/
 
@@ -203,6 +206,70 @@ retry:
 }
 #endif
 
+#if CONFIG_TX_RX_ZERO_COPY && CONFIG_IMU_RX_ZERO_COPY && defined(RW610)
+#if !LWIP_SUPPORT_CUSTOM_PBUF
+#error "CONFIG_IMU_RX_ZERO_COPY requires LWIP_SUPPORT_CUSTOM_PBUF"
+#endif
+
+/* Custom pbuf referencing an IMU rx buffer. The IMU buffer has no headroom,
+ * so the mlan_buffer reserved in front of copied frames lives here instead */
+typedef struct
+{
+    struct pbuf_custom pc;
+    mlan_buffer mbuf;
+    t_u8 *rx_buf;
+} rx_zerocopy_pbuf_t;
+
+LWIP_MEMPOOL_DECLARE(RX_ZEROCOPY_POOL, CONFIG_IMU_RX_ZERO_COPY_BUF_NUM, sizeof(rx_zerocopy_pbuf_t), "Zero-copy RX PBUF pool");
+
+static void rx_zerocopy_pbuf_free(struct pbuf *p)
+{
+    rx_zerocopy_pbuf_t *zc = (rx_zerocopy_pbuf_t *)(void *)p;
+
+    /* Give the buffer back to the firmware */
+    wifi_imu_return_rx_buf(zc->rx_buf);
+    LWIP_MEMPOOL_FREE(RX_ZEROCOPY_POOL, zc);
+}
+
+static struct pbuf *gen_pbuf_from_data_in_place(t_u8 *rcvdata, t_u16 datalen)
+{
+    rx_zerocopy_pbuf_t *zc = (rx_zerocopy_pbuf_t *)LWIP_MEMPOOL_ALLOC(RX_ZEROCOPY_POOL);
+    struct pbuf *p         = NULL;
+
+    if (zc == NULL)
+    {
+        return NULL;
+    }
+
+    zc->pc.custom_free_function = rx_zerocopy_pbuf_free;
+    zc->rx_buf                  = rcvdata;
+    p = pbuf_alloced_custom(PBUF_RAW, datalen, PBUF_REF, &zc->pc, rcvdata, datalen);
+    if (p == NULL)
+    {
+        LWIP_MEMPOOL_FREE(RX_ZEROCOPY_POOL, zc);
+        return NULL;
+    }
+
+    /* The IMU buffer is released from rx_zerocopy_pbuf_free() from now on */
+    wifi_imu_hold_rx_buf();
+
+    return p;
+}
+
+void *net_rx_zerocopy_mlan_buffer(void *stack_buffer, RxPD *rxpd)
+{
+    struct pbuf *p = (struct pbuf *)stack_buffer;
+
+    if ((p->flags & PBUF_FLAG_IS_CUSTOM) != 0U)
+    {
+        return &((rx_zerocopy_pbuf_t *)(void *)p)->mbuf;
+    }
+
+    /* Frame was copied, mlan_buffer is in the pbuf headroom */
+    return (t_u8 *)rxpd - INTF_HEADER_LEN - sizeof(mlan_buffer);
+}
+#endif
+
 static struct pbuf *gen_pbuf_from_data(t_u8 *payload, t_u16 datalen)
 {
     t_u8 retry_cnt = 3;
@@ -320,7 +387,16 @@ static void process_data_packet(const t_u8 *rcvdata,
     u16_t header_len = INTF_HEADER_LEN + rxpd->rx_pkt_offset;
     payload_len = rxpd->rx_pkt_length + header_len + sizeof(mlan_buffer);
 #ifdef RW610
+#if CONFIG_IMU_RX_ZERO_COPY
+    /* Reference the IMU buffer directly, copy only when all wrappers are in use */
+    p = gen_pbuf_from_data_in_place((t_u8 *)rcvdata, payload_len - sizeof(mlan_buffer));
+    if (p == NULL)
+    {
+        p = gen_pbuf_from_data_for_zerocopy((t_u8 *)rcvdata, payload_len);
+    }
+#else
     p           = gen_pbuf_from_data_for_zerocopy((t_u8 *)rcvdata, payload_len);
+#endif
 #else
     p           = (struct pbuf *)(void *)rcvdata;
     (void)payload_len;
@@ -536,6 +612,16 @@ bool wrapper_net_is_ip_or_ipv6(const t_u8 *buffer)
  */
 static void low_level_init(struct netif *netif)
 {
+#if CONFIG_TX_RX_ZERO_COPY && CONFIG_IMU_RX_ZERO_COPY && defined(RW610)
+    static bool rx_zerocopy_pool_init;
+
+    if (!rx_zerocopy_pool_init)
+    {
+        LWIP_MEMPOOL_INIT(RX_ZEROCOPY_POOL);
+        rx_zerocopy_pool_init = true;
+    }
+#endif
+
     /* set MAC hardware address length */
     netif->hwaddr_len = ETHARP_HWADDR_LEN;
 
@@ -546,6 +632,9 @@ static void low_level_init(struct netif *netif)
     /* don't set NETIF_FLAG_ETHARP if this device is not an ethernet one */
     netif->flags = NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP | NETIF_FLAG_LINK_UP;
 
+    /* No checksum offload: TxPD/RxPD have no checksum flags and the firmware reports
+     * no such capability, so lwIP generates and checks all checksums (see LWIP_PORT_CHKSUM) */
+
     netif_set_igmp_mac_filter(netif, igmp_mac_filter);
     netif->flags |= NETIF_FLAG_IGMP;
 #if CONFIG_IPV6
@@ -609,6 +698,8 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p, bool pkt_fwd)
     int retry                     = 0;
     t_u8 ra[MLAN_MAC_ADDR_LENGTH] = {0};
     bool is_tx_pause              = false;
+    t_u32 wait_start;
+    t_u32 waited;
 
     t_u32 pkt_prio = wifi_wmm_get_pkt_prio(p, &tid);
     if (pkt_prio == -WM_FAIL)
@@ -640,6 +731,7 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p, bool pkt_fwd)
 
     wifi_wmm_da_to_ra(p->payload, ra);
 
+    wait_start = OSA_TimeGetMsec();
     do
     {
         if (retry != 0)
@@ -658,19 +750,32 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p, bool pkt_fwd)
             }
         }
 
+        if (!pkt_fwd)
+        {
+            /* Drop stale wake-ups, a buffer put back from now on wakes the wait below */
+            wifi_wmm_outbuf_clear();
+        }
+
         wmm_outbuf = wifi_wmm_get_outbuf_enh(&outbuf_len, (mlan_wmm_ac_e)pkt_prio, interface, ra, &is_tx_pause);
         ret        = (wmm_outbuf == NULL) ? true : false;
 
         /* In packet forward case, this function is called by RX thread,
-         * so the time delay is not allowed */
-        if (!pkt_fwd)
+         * so blocking is not allowed */
+        if (!pkt_fwd && ret == true && is_tx_pause == true)
         {
-            if (ret == true && is_tx_pause == true)
+            /* Sleep until a buffer is put back or the RA is resumed. While blocked,
+             * the retry budget is retry_attempts ms however often the wait wakes up */
+            waited = OSA_TimeGetMsec() - wait_start;
+            if (waited >= (t_u32)retry_attempts)
             {
-                OSA_TimeDelay(1);
+                break;
             }
+            (void)wifi_wmm_wait_outbuf((mlan_wmm_ac_e)pkt_prio, (t_u32)retry_attempts - waited);
+        }
+        else
+        {
+            retry--;
         }
-        retry--;
     } while (ret == true && retry > 0);
 
     if (ret == true)
@@ -213,6 +213,8 @@ mlan_status wlan_ret_wmm_param_config(pmlan_private pmpriv, const HostCmd_DS_COM
 #endif
 #define WMM_DATA_LEN    1580
 #define OUTBUF_WMM_LEN  (sizeof(outbuf_t))
+/* txbuf_avail_event flag */
+#define WMM_TXBUF_EVENT_AVAIL (1U << 0)
 
 typedef struct
 {
@@ -262,6 +264,11 @@ void wifi_wmm_buf_put(outbuf_t *buf);
 int wifi_wmm_buf_pool_init(uint8_t *pool);
 void wifi_wmm_buf_pool_deinit(void);
 
+/* wmm enhance tx buffer wait */
+void wifi_wmm_outbuf_notify(void);
+void wifi_wmm_outbuf_clear(void);
+int wifi_wmm_wait_outbuf(mlan_wmm_ac_e queue, t_u32 timeout_ms);
+
 /* wmm enhance ralist operation */
 void wlan_ralist_add_enh(mlan_private *priv, t_u8 *ra);
 int wlan_ralist_update_enh(mlan_private *priv, t_u8 *old_ra, t_u8 *new_ra);
@@ -790,6 +790,18 @@ hal_imumc_status_t HAL_ImuDeinit(imu_link_t link, uint32_t flag);
  */
 hal_imumc_status_t HAL_ImuReturnAllTxBuf(imu_link_t link);
 
+/*!
+ * @brief Return one held rx buffer.
+ *
+ * This function is used to return an rx buffer to the peer CPU after the rx handler
+ * kept it by clearing its payload pointer in the rx message.
+ *
+ * @param link                 IMU link ID.
+ * @param rxBuf                Rx buffer address.
+ * @retval kStatus_HAL_ImumcSuccess or kStatus_HAL_ImumcError.
+ */
+hal_imumc_status_t HAL_ImuReturnRxBuf(imu_link_t link, uint8_t *rxBuf);
+
 /*!
  * @brief Receive IMU message.
  *
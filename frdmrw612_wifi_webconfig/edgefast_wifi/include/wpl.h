@@ -8,10 +8,13 @@
 #define _WPL_H_
 
 #include "stdbool.h"
+#include "stdint.h"
 
 #define WPL_WIFI_SSID_LENGTH      32U
 #define WPL_WIFI_PASSWORD_MIN_LEN 8U
 #define WPL_WIFI_PASSWORD_LENGTH  63U
+#define WPL_WIFI_BSSID_LENGTH     6U
+#define WPL_WIFI_PMK_LENGTH       32U
 
 /* IP Address of Wi-Fi interface in AP (Access Point) mode */
 #ifndef WPL_WIFI_AP_IP_ADDR
@@ -134,6 +137,33 @@ wpl_ret_t WPL_AddNetworkWithSecurity(const char *ssid, const char *password, con
  */
 wpl_ret_t WPL_AddNetwork(const char *ssid, const char *password, const char *label);
 
+/**
+ * @brief  Create and save a new STA (Station) network profile with hints cached from a previous connection.
+ *         Known BSSID and channel restrict the scan to a single channel, known PMK skips its derivation
+ *         from the password. If the network cannot be found using the hints, it has to be added again without them.
+ *         WPL_AddNetworkWithHints should be called only after WPL_Start was successfully performed.
+ * @param  ssid Name of the STA network to be created.
+ * @param  password Password of the STA network to be created.
+ * @param  label Alias for the network to be added. A network may be referred by its label.
+ * @param  bssid BSSID of the access point (WPL_WIFI_BSSID_LENGTH bytes), NULL if unknown.
+ * @param  channel Channel of the access point, 0 if unknown.
+ * @param  pmk PMK for the ssid and password (WPL_WIFI_PMK_LENGTH bytes), NULL if unknown.
+ * @return WPLRET_SUCCESS New STA network profile was successfully saved.
+ */
+wpl_ret_t WPL_AddNetworkWithHints(
+    const char *ssid, const char *password, const char *label, const uint8_t *bssid, int channel, const uint8_t *pmk);
+
+/**
+ * @brief  Get hints for WPL_AddNetworkWithHints from the network the STA interface is connected to.
+ *         WPL_GetNetworkHints should be called only after WPL_Join was successfully performed.
+ * @param  bssid Buffer for BSSID of the access point (WPL_WIFI_BSSID_LENGTH bytes).
+ * @param  channel Pointer where channel of the access point should be stored.
+ * @param  pmk Buffer for PMK (WPL_WIFI_PMK_LENGTH bytes).
+ * @param  pmk_valid Pointer where validity of the PMK should be stored, PMK is not used by all security types.
+ * @return WPLRET_SUCCESS The hints were successfully retrieved.
+ */
+wpl_ret_t WPL_GetNetworkHints(uint8_t *bssid, int *channel, uint8_t *pmk, bool *pmk_valid);
+
 /**
  * @brief  Delete a previously added STA (Station) network profile.
  *         The profile to be deleted is referred by its label and should have been previously added using
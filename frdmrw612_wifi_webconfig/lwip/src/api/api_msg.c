@@ -1527,45 +1527,44 @@ lwip_netconn_do_listen(void *m)
 #endif /* LWIP_TCP */
 
 /**
- * Send some data on a RAW or UDP pcb contained in a netconn
- * Called from netconn_send
+ * Send one netbuf on a RAW or UDP pcb contained in a netconn
  *
- * @param m the api_msg pointing to the connection
+ * @param conn the netconn to send on
+ * @param b the netbuf holding data and destination
+ * @return ERR_OK if the data was sent, another err_t otherwise
  */
-void
-lwip_netconn_do_send(void *m)
+static err_t
+lwip_netconn_send_netbuf(struct netconn *conn, struct netbuf *b)
 {
-  struct api_msg *msg = (struct api_msg *)m;
-
-  err_t err = netconn_err(msg->conn);
+  err_t err = netconn_err(conn);
   if (err == ERR_OK) {
-    if (msg->conn->pcb.tcp != NULL) {
-      switch (NETCONNTYPE_GROUP(msg->conn->type)) {
+    if (conn->pcb.tcp != NULL) {
+      switch (NETCONNTYPE_GROUP(conn->type)) {
 #if LWIP_RAW
         case NETCONN_RAW:
-          if (ip_addr_isany(&msg->msg.b->addr) || IP_IS_ANY_TYPE_VAL(msg->msg.b->addr)) {
-            err = raw_send(msg->conn->pcb.raw, msg->msg.b->p);
+          if (ip_addr_isany(&b->addr) || IP_IS_ANY_TYPE_VAL(b->addr)) {
+            err = raw_send(conn->pcb.raw, b->p);
           } else {
-            err = raw_sendto(msg->conn->pcb.raw, msg->msg.b->p, &msg->msg.b->addr);
+            err = raw_sendto(conn->pcb.raw, b->p, &b->addr);
           }
           break;
 #endif
 #if LWIP_UDP
         case NETCONN_UDP:
 #if LWIP_CHECKSUM_ON_COPY
-          if (ip_addr_isany(&msg->msg.b->addr) || IP_IS_ANY_TYPE_VAL(msg->msg.b->addr)) {
-            err = udp_send_chksum(msg->conn->pcb.udp, msg->msg.b->p,
-                                  msg->msg.b->flags & NETBUF_FLAG_CHKSUM, msg->msg.b->toport_chksum);
+          if (ip_addr_isany(&b->addr) || IP_IS_ANY_TYPE_VAL(b->addr)) {
+            err = udp_send_chksum(conn->pcb.udp, b->p,
+                                  b->flags & NETBUF_FLAG_CHKSUM, b->toport_chksum);
           } else {
-            err = udp_sendto_chksum(msg->conn->pcb.udp, msg->msg.b->p,
-                                    &msg->msg.b->addr, msg->msg.b->port,
-                                    msg->msg.b->flags & NETBUF_FLAG_CHKSUM, msg->msg.b->toport_chksum);
+            err = udp_sendto_chksum(conn->pcb.udp, b->p,
+                                    &b->addr, b->port,
+                                    b->flags & NETBUF_FLAG_CHKSUM, b->toport_chksum);
           }
 #else /* LWIP_CHECKSUM_ON_COPY */
-          if (ip_addr_isany_val(msg->msg.b->addr) || IP_IS_ANY_TYPE_VAL(msg->msg.b->addr)) {
-            err = udp_send(msg->conn->pcb.udp, msg->msg.b->p);
+          if (ip_addr_isany_val(b->addr) || IP_IS_ANY_TYPE_VAL(b->addr)) {
+            err = udp_send(conn->pcb.udp, b->p);
           } else {
-            err = udp_sendto(msg->conn->pcb.udp, msg->msg.b->p, &msg->msg.b->addr, msg->msg.b->port);
+            err = udp_sendto(conn->pcb.udp, b->p, &b->addr, b->port);
           }
 #endif /* LWIP_CHECKSUM_ON_COPY */
           break;
@@ -1578,9 +1577,50 @@ lwip_netconn_do_send(void *m)
       err = ERR_CONN;
     }
   }
+  return err;
+}
+
+/**
+ * Send some data on a RAW or UDP pcb contained in a netconn
+ * Called from netconn_send
+ *
+ * @param m the api_msg pointing to the connection
+ */
+void
+lwip_netconn_do_send(void *m)
+{
+  struct api_msg *msg = (struct api_msg *)m;
+
+  msg->err = lwip_netconn_send_netbuf(msg->conn, msg->msg.b);
+  TCPIP_APIMSG_ACK(msg);
+}
+
+#if LWIP_SOCKET_MMSG
+/**
+ * Send several netbufs on a RAW or UDP pcb contained in a netconn,
+ * stopping at the first one that fails.
+ * Called from netconn_send_multi
+ *
+ * @param m the api_msg pointing to the connection
+ */
+void
+lwip_netconn_do_send_multi(void *m)
+{
+  struct api_msg *msg = (struct api_msg *)m;
+  err_t err = ERR_OK;
+  u16_t i;
+
+  for (i = 0; i < msg->msg.bm.count; i++) {
+    err = lwip_netconn_send_netbuf(msg->conn, msg->msg.bm.bufs[i]);
+    if (err != ERR_OK) {
+      break;
+    }
+  }
+  msg->msg.bm.sent = i;
   msg->err = err;
   TCPIP_APIMSG_ACK(msg);
 }
+#endif /* LWIP_SOCKET_MMSG */
 
 #if LWIP_TCP
 /**
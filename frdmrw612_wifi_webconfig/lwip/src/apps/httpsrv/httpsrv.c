@@ -129,6 +129,11 @@ uint32_t HTTPSRV_cgi_write(HTTPSRV_CGI_RES_STRUCT *response)
         {
             session->flags |= HTTPSRV_FLAG_IS_TRANSCODED;
         }
+        else if (response->content_length == 0)
+        {
+            /* Length is not known, end of response is signalled by closing connection */
+            session->flags &= ~HTTPSRV_FLAG_IS_KEEP_ALIVE;
+        }
 
         /*
          * Ignore rest of received data in buffer (set buffer offset to zero).
@@ -139,6 +144,11 @@ uint32_t HTTPSRV_cgi_write(HTTPSRV_CGI_RES_STRUCT *response)
         {
             session->request.content_length -= session->buffer.offset;
         }
+        else
+        {
+            /* Data following request body are dropped, connection can not be kept */
+            session->flags &= ~HTTPSRV_FLAG_IS_KEEP_ALIVE;
+        }
         session->buffer.offset = 0;
         httpsrv_sendhdr(session, response->content_length, 1);
     }
@@ -221,11 +231,8 @@ uint32_t HTTPSRV_cgi_read(uint32_t ses_handle, char *buffer, uint32_t length)
     }
     else
     {
-        int optval;
-        socklen_t optlen = sizeof(optval);
-
         /* Timeout */
-        if ((lwip_getsockopt(session->sock, SOL_SOCKET, SO_ERROR, &optval, &optlen) == 0) && (optval == EWOULDBLOCK))
+        if ((retval < 0) && ((errno == EWOULDBLOCK) || (errno == EAGAIN)))
         {
             retval = 0;
         }
@@ -79,13 +79,19 @@
 #define HTTPSRV_CFG_MAX_SCRIPT_LN (32)
 #endif
 
+/* Keep connection open for further requests (HTTP/1.1 persistent connections and pipelining) */
 #ifndef HTTPSRV_CFG_KEEPALIVE_ENABLED
 #define HTTPSRV_CFG_KEEPALIVE_ENABLED (0)
 #endif
 
-/* Session keep-alive timeout in milliseconds */
+/* Session keep-alive timeout in milliseconds, idle time after response before connection is closed */
 #ifndef HTTPSRV_CFG_KEEPALIVE_TIMEOUT
-#define HTTPSRV_CFG_KEEPALIVE_TIMEOUT (200)
+#define HTTPSRV_CFG_KEEPALIVE_TIMEOUT (2000)
+#endif
+
+/* Maximum number of requests served over one keep-alive connection, response to the last one closes it */
+#ifndef HTTPSRV_CFG_KEEPALIVE_MAX_REQUESTS
+#define HTTPSRV_CFG_KEEPALIVE_MAX_REQUESTS (100)
 #endif
 
 /* Session timeout in milliseconds */
@@ -93,10 +99,25 @@
 #define HTTPSRV_CFG_SES_TIMEOUT (20000)
 #endif
 
-/* Socket OPT_SEND_TIMEOUT option value */
+/* Serve all sessions from the server task with select() instead of task per session */
+#ifndef HTTPSRV_CFG_SINGLE_TASK
+#define HTTPSRV_CFG_SINGLE_TASK (0)
+#endif
+
+/* Socket OPT_SEND_TIMEOUT option value. Client not reading its response blocks all sessions in single task mode. */
 #ifndef HTTPSRV_CFG_SEND_TIMEOUT
+#if HTTPSRV_CFG_SINGLE_TASK
+#define HTTPSRV_CFG_SEND_TIMEOUT (2000)
+#else
 #define HTTPSRV_CFG_SEND_TIMEOUT (0)
 #endif
+#endif
+
+/* Send static files straight from file system memory instead of copying them through session buffer.
+ * File data must stay unchanged until acknowledged by client, which holds for files of HTTPSRV_FS in flash. */
+#ifndef HTTPSRV_CFG_SEND_NOCOPY
+#define HTTPSRV_CFG_SEND_NOCOPY (1)
+#endif
 
 /* Socket OPT_RECEIVE_TIMEOUT option value */
 #ifndef HTTPSRV_CFG_RECEIVE_TIMEOUT
@@ -122,4 +143,8 @@
 #error You may not enable both WolfSSL and MbedTLS simultaneously
 #endif
 
+#if HTTPSRV_CFG_SINGLE_TASK && (HTTPSRV_CFG_WOLFSSL_ENABLE || HTTPSRV_CFG_MBEDTLS_ENABLE)
+#error Single task mode does not support TLS, data buffered by TLS library is not visible to select()
+#endif
+
 #endif /* _HTTPSRV_CONFIG_H_ */
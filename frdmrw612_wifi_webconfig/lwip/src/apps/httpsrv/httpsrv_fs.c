@@ -15,12 +15,15 @@
 #include "httpsrv_fs.h"
 #include "httpsrv_port.h"
 
+static inline uint32_t httpsrv_fs_fold(uint32_t);
 static int32_t httpsrv_fs_cmp(char *, char *);
+static bool httpsrv_fs_match(const char *, const char *);
 static const HTTPSRV_FS_DIR_ENTRY *httpsrv_fs_open_file(char *, int32_t *);
 static uint32_t httpsrv_fs_read(HTTPSRV_FS_FILE_PTR, uint32_t, char *, int32_t *);
 static uint32_t httpsrv_fs_move_file_pointer(HTTPSRV_FS_FILE_PTR, int32_t *);
 
 const HTTPSRV_FS_DIR_ENTRY *ROOT;
+static const HTTPSRV_FS_INDEX *INDEX;
 
 /*FUNCTION*-------------------------------------------------------------------
  *
@@ -34,7 +37,24 @@ void HTTPSRV_FS_init(
     /*[IN] pointer to the first entry of the root HTTPSRV_FS directory  */
     const HTTPSRV_FS_DIR_ENTRY *root)
 {
-    ROOT = root;
+    ROOT  = root;
+    INDEX = NULL;
+}
+
+/*FUNCTION*-------------------------------------------------------------------
+ *
+ * Function Name    : HTTPSRV_FS_init_index
+ * Returned Value   : None.
+ * Comments         : Initialize the Trivial File System with directory index.
+ *
+ *END*---------------------------------------------------------------------*/
+
+void HTTPSRV_FS_init_index(
+    /*[IN] directory index generated along with the root directory */
+    const HTTPSRV_FS_INDEX *index)
+{
+    ROOT  = index->ROOT;
+    INDEX = index;
 }
 
 /*FUNCTION*-------------------------------------------------------------------
@@ -256,6 +276,16 @@ int32_t HTTPSRV_FS_ioctl(
                     ((HTTPSRV_FS_DIR_ENTRY_PTR)file_ptr->DEV_DATA_PTR)->DATA + file_ptr->LOCATION;
             }
             break;
+        case IO_IOCTL_HTTPSRV_FS_GET_ETAG:
+            if (file_ptr->DEV_DATA_PTR == NULL)
+            {
+                error_code = HTTPSRV_FS_ERROR_INVALID_FILE_HANDLE;
+            }
+            else
+            {
+                *((char **)param_ptr) = ((HTTPSRV_FS_DIR_ENTRY_PTR)file_ptr->DEV_DATA_PTR)->ETAG;
+            }
+            break;
         case IO_IOCTL_HTTPSRV_FS_GET_LAST_ERROR:
             error_code = file_ptr->ERROR;
             break;
@@ -267,6 +297,25 @@ int32_t HTTPSRV_FS_ioctl(
     return (error_code);
 }
 
+/*FUNCTION*-------------------------------------------------------------------
+ *
+ * Function Name    : httpsrv_fs_fold
+ * Returned Value   : Normalized path character.
+ * Comments         : Converts character to upper case and '\' to '/'.
+ *
+ *END*---------------------------------------------------------------------*/
+
+static inline uint32_t httpsrv_fs_fold(
+    /* [IN] path character */
+    uint32_t ch)
+{
+    if (ch == '\\')
+        return '/';
+    if ((uint32_t)(ch - 'a') <= (uint32_t)('z' - 'a'))
+        return ch - 'a' + 'A';
+    return ch;
+}
+
 /*FUNCTION*-------------------------------------------------------------------
  *
  * Function Name    : httpsrv_fs_cmp
@@ -293,22 +342,38 @@ static int32_t httpsrv_fs_cmp(
         return 1;
     do
     {
-        ch1 = *path1++;
-        ch2 = *path2++;
-        if (ch1 == '\\')
-            ch1 = '/';
-        if ((uint32_t)(ch1 - 'a') <= (uint32_t)('z' - 'a'))
-            ch1 = ch1 - 'a' + 'A';
-        if (ch2 == '\\')
-            ch2 = '/';
-        if ((uint32_t)(ch2 - 'a') <= (uint32_t)('z' - 'a'))
-            ch2 = ch2 - 'a' + 'A';
+        ch1 = httpsrv_fs_fold((uint8_t)*path1++);
+        ch2 = httpsrv_fs_fold((uint8_t)*path2++);
         if ((ch1 == '\0') || (ch2 == '\0'))
             return (int32_t)(ch1 - ch2);
     } while (ch1 == ch2);
     return (int32_t)(ch1 - ch2);
 }
 
+/*FUNCTION*-------------------------------------------------------------------
+ *
+ * Function Name    : httpsrv_fs_match
+ * Returned Value   : TRUE if the paths are equal.
+ * Comments         : Compares normalized path of index with file path. Only
+ *                    the file path is normalized.
+ *
+ *END*---------------------------------------------------------------------*/
+
+static bool httpsrv_fs_match(
+    /* [IN] normalized file path */
+    const char *normalized,
+
+    /* [IN] file path to compare */
+    const char *path)
+{
+    while (*normalized != '\0')
+    {
+        if ((uint8_t)*normalized++ != httpsrv_fs_fold((uint8_t)*path++))
+            return false;
+    }
+    return (*path == '\0');
+}
+
 /*FUNCTION*-------------------------------------------------------------------
  *
  * Function Name    : httpsrv_fs_open_file
@@ -335,7 +400,32 @@ static const HTTPSRV_FS_DIR_ENTRY *httpsrv_fs_open_file(
         return NULL;
     }
     *error_ptr = HTTPSRV_FS_FILE_NOT_FOUND;
-    entry      = /* (HTTPSRV_FS_DIR_ENTRY_PTR)drive_ptr-> */ ROOT;
+
+    if (INDEX != NULL)
+    {
+        const HTTPSRV_FS_INDEX_SLOT *slot;
+        uint32_t hash = HTTPSRV_FS_HASH_INIT;
+        uint32_t i;
+        char *ch;
+
+        for (ch = pathname; *ch != '\0'; ch++)
+            hash = HTTPSRV_FS_HASH_STEP(hash, httpsrv_fs_fold((uint8_t)*ch));
+
+        /* Index always has an empty slot, the probing terminates */
+        for (i = hash & INDEX->MASK;; i = (i + 1) & INDEX->MASK)
+        {
+            slot = &INDEX->SLOTS[i];
+            if (slot->ENTRY == 0)
+                return NULL;
+            if ((slot->HASH == hash) && httpsrv_fs_match(slot->NAME, pathname))
+            {
+                *error_ptr = HTTPSRV_FS_OK;
+                return &INDEX->ROOT[slot->ENTRY - 1];
+            }
+        }
+    }
+
+    entry = /* (HTTPSRV_FS_DIR_ENTRY_PTR)drive_ptr-> */ ROOT;
     while (entry->NAME != NULL)
     {
         if (httpsrv_fs_cmp(entry->NAME, pathname) == 0)
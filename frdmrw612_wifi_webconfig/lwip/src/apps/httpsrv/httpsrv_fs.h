@@ -21,6 +21,8 @@
 
 #define HTTPSRV_FS_FLAG_INDEX 1
 #define HTTPSRV_FS_FLAG_AUTH  2
+#define HTTPSRV_FS_FLAG_GZIP     4 /* DATA is gzip compressed */
+#define HTTPSRV_FS_FLAG_HAS_GZIP 8 /* Compressed copy is stored with ".gz" appended to the name */
 
 /*
 ** error codes
@@ -70,6 +72,7 @@
 #define IO_IOCTL_HTTPSRV_FS_GET_LENGTH           (0x03)
 #define IO_IOCTL_HTTPSRV_FS_GET_LAST_ERROR       (0x04)
 #define IO_IOCTL_HTTPSRV_FS_GET_CURRENT_DATA_PTR (0x05)
+#define IO_IOCTL_HTTPSRV_FS_GET_ETAG             (0x07)
 
 #define IO_IOCTL_HTTPSRV_FS_SEEK (0x06)
 
@@ -89,8 +92,43 @@ typedef struct httpsrv_fs_dir_entry
     uint32_t FLAGS;
     unsigned char *DATA;
     uint32_t SIZE;
+    char *ETAG; /* Strong entity tag of DATA including the quotes, may be NULL */
 } HTTPSRV_FS_DIR_ENTRY, *HTTPSRV_FS_DIR_ENTRY_PTR;
 
+/*
+** HTTP_SRV directory index slot, generated by mkfs.pl
+**
+** NAME is the file path normalized to upper case with '/' delimiters, HASH
+** is HTTPSRV_FS_HASH of NAME. ENTRY is index of the directory entry plus one,
+** zero marks empty slot.
+*/
+typedef struct httpsrv_fs_index_slot
+{
+    uint32_t HASH;
+    const char *NAME;
+    uint32_t ENTRY;
+} HTTPSRV_FS_INDEX_SLOT;
+
+/*
+** HTTP_SRV directory index
+**
+** Open addressed hash table of the directory entries with linear probing.
+** Number of slots is power of two and at least twice the number of files,
+** so there is always an empty slot terminating the probe sequence.
+*/
+typedef struct httpsrv_fs_index
+{
+    const HTTPSRV_FS_DIR_ENTRY *ROOT;
+    const HTTPSRV_FS_INDEX_SLOT *SLOTS;
+    uint32_t MASK; /* number of slots minus one */
+} HTTPSRV_FS_INDEX;
+
+/*
+** Hash of normalized file path (FNV-1a), must match the one of mkfs.pl
+*/
+#define HTTPSRV_FS_HASH_INIT          (2166136261UL)
+#define HTTPSRV_FS_HASH_STEP(hash, c) (((hash) ^ (uint32_t)(c)) * 16777619UL)
+
 /* FILE STRUCTURE */
 
 /*!
@@ -117,6 +155,14 @@ extern "C" {
 #endif
 
 void HTTPSRV_FS_init(const HTTPSRV_FS_DIR_ENTRY *);
+/*!
+ * \brief Initializes the file system with directory index generated by mkfs.pl.
+ *
+ * Files are looked up by hash of the path instead of walking the directory.
+ *
+ * \param[in] index Directory index, its ROOT is the directory.
+ */
+void HTTPSRV_FS_init_index(const HTTPSRV_FS_INDEX *index);
 HTTPSRV_FS_FILE_PTR HTTPSRV_FS_open(char *);
 void HTTPSRV_FS_close(HTTPSRV_FS_FILE_PTR);
 int32_t HTTPSRV_FS_read(HTTPSRV_FS_FILE_PTR, char *, int32_t);
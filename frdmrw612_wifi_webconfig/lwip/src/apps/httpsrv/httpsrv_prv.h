@@ -28,6 +28,7 @@
 #define HTTPSRV_SES_BUF_SIZE_PRV    (HTTPSRV_CFG_SES_BUFFER_SIZE)
 #define HTTPSRV_TMP_BUFFER_SIZE     (128)
 #define HTTPSRV_PLUGIN_NUM_MESSAGES (5)
+#define HTTPSRV_IF_NONE_MATCH_SIZE  (64) /* Longer If-None-Match values are ignored */
 
 #define HTTPSRV_FLAG_PROCESS_HEADER     (1 << 0) /* Flag for indication of header processing */
 #define HTTPSRV_FLAG_HAS_HOST           (1 << 1) /* Flag determining if request header has "host" field */
@@ -38,6 +39,9 @@
 #define HTTPSRV_FLAG_KEEP_ALIVE_ENABLED (1 << 6) /* Keep-alive enabled/disabled for session */
 #define HTTPSRV_FLAG_HAS_CONTENT_LENGTH (1 << 7) /* Flag signalizing presence of Content-Length in request. */
 #define HTTPSRV_FLAG_HEADER_SENT        (1 << 8) /* Flag signalizing if response header was sent. */
+#define HTTPSRV_FLAG_ACCEPT_GZIP        (1 << 9) /* Client accepts gzip content encoding. */
+#define HTTPSRV_FLAG_HAS_IF_NONE_MATCH  (1 << 10) /* Request has "If-None-Match" field saved in request structure. */
+#define HTTPSRV_FLAG_IS_PIPELINED       (1 << 11) /* Buffer holds pipelined request not parsed yet. */
 
 /*
 **  Wildcard typedef for CGI/SSI callback prototype
@@ -112,12 +116,12 @@ typedef struct httpsrv_req_struct
     HTTPSRV_REQ_METHOD method;       /* Request method (GET, POST, HEAD) */
     int content_type;                /* Request entity content type */
     int32_t content_length;          /* Content length */
-    uint32_t pending;                /* Number of bytes in request not parsed */
     uint32_t lines;                  /* Number of request lines */
     char *path;                      /* Requested path */
     char *query;                     /* Data send in URL */
     HTTPSRV_AUTH_USER_STRUCT auth;   /* Authentication credentials received from client */
     HTTPSRV_UPGRADE_PROT upgrade_to; /* Protocol to upgrade to. Zero = no upgrade. */
+    char if_none_match[HTTPSRV_IF_NONE_MATCH_SIZE]; /* Entity tags of cached response */
 } HTTPSRV_REQ_STRUCT;
 
 /*
@@ -160,6 +164,8 @@ typedef struct httpsrv_session_struct
         time;         /* Session time. Updated when there is some activity in session. Used for timeout detection. */
     uint32_t timeout; /* Session timeout in ms. timeout_time = time + timeout */
     HTTPSRV_BUFF_STRUCT buffer;        /* Session internal read/write buffer */
+    HTTPSRV_BUFF_STRUCT pipeline;      /* Data received after request header, parsed once response is sent */
+    uint32_t requests;                 /* Number of requests received over connection */
     HTTPSRV_REQ_STRUCT request;        /* Data read from the request */
     HTTPSRV_RES_STRUCT response;       /* Response data */
     sys_sem_t lock;                    /* Session lock */
@@ -143,6 +143,8 @@ static void httpsrv_process_file_type(char *extension, HTTPSRV_SESSION_STRUCT *s
 static int32_t httpsrv_set_params(HTTPSRV_STRUCT *server, HTTPSRV_PARAM_STRUCT *params);
 static int32_t httpsrv_init_socket(HTTPSRV_STRUCT *server);
 static int httpsrv_basic_auth(char *auth_string, char **user_ptr, char **pass_ptr);
+static bool httpsrv_accept_gzip(const char *value);
+static bool httpsrv_send_nocopy(HTTPSRV_SESSION_STRUCT *session, int *length);
 #if HTTPSRV_CFG_WEBSOCKET_ENABLED
 static void *httpsrv_ws_alloc(HTTPSRV_SESSION_STRUCT *session);
 #endif
@@ -709,8 +711,37 @@ void httpsrv_sendhdr(HTTPSRV_SESSION_STRUCT *session, int32_t content_len, bool
             }
         }
     }
-    /* Only non zero length cause sending Content-Length header field */
-    if (content_len > 0)
+    /* Entity tag and encoding of static file */
+    if ((session->response.file != NULL) && ((session->response.status_code == HTTPSRV_CODE_OK) ||
+                                             (session->response.status_code == HTTPSRV_CODE_NOT_MODIFIED)))
+    {
+        char *etag     = NULL;
+        uint32_t flags = 0;
+
+        HTTPSRV_FS_ioctl(session->response.file, IO_IOCTL_HTTPSRV_FS_GET_ETAG, &etag);
+        HTTPSRV_FS_ioctl(session->response.file, IO_IOCTL_HTTPSRV_FS_GET_ATTRIBUTES, &flags);
+        if (etag != NULL)
+        {
+            httpsrv_print(session, "ETag: %s\r\n", etag);
+        }
+        if (flags & (HTTPSRV_FS_FLAG_GZIP | HTTPSRV_FS_FLAG_HAS_GZIP))
+        {
+            if ((flags & HTTPSRV_FS_FLAG_GZIP) && (session->response.status_code == HTTPSRV_CODE_OK))
+            {
+                httpsrv_print(session, "Content-Encoding: gzip\r\n");
+            }
+            httpsrv_print(session, "Vary: Accept-Encoding\r\n");
+        }
+    }
+
+    /*
+     * Only non zero length cause sending Content-Length header field,
+     * unless client needs it to find end of empty response on kept alive connection.
+     */
+    if ((content_len > 0) ||
+        ((session->flags & HTTPSRV_FLAG_IS_KEEP_ALIVE) && !(session->flags & HTTPSRV_FLAG_IS_TRANSCODED) &&
+         (session->response.status_code != HTTPSRV_CODE_NOT_MODIFIED) &&
+         (session->response.status_code != HTTPSRV_CODE_UPGRADE)))
     {
         httpsrv_print(session, "Content-Length: %d\r\n", content_len);
     }
@@ -769,6 +800,128 @@ void httpsrv_send_err_page(HTTPSRV_SESSION_STRUCT *session, const char *title, c
     }
 }
 
+/*
+** Open static file variant matching encodings accepted by client.
+**
+** IN:
+**      HTTPSRV_SESSION_STRUCT* session - session to open file for
+**      char*                   path - full path of requested file
+**
+** OUT:
+**      none
+**
+** Return Value:
+**      int32_t - HTTPSRV_CODE_OK, HTTPSRV_CODE_NOT_FOUND, HTTPSRV_CODE_NOT_ACCEPTABLE or HTTPSRV_CODE_INTERNAL_ERROR.
+*/
+int32_t httpsrv_file_open(HTTPSRV_SESSION_STRUCT *session, char *path)
+{
+    HTTPSRV_FS_FILE_PTR file;
+    uint32_t flags = 0;
+    uint32_t length;
+    char *gz_path;
+
+    file = HTTPSRV_FS_open(path);
+    if (file != NULL)
+    {
+        HTTPSRV_FS_ioctl(file, IO_IOCTL_HTTPSRV_FS_GET_ATTRIBUTES, &flags);
+        if (!(flags & HTTPSRV_FS_FLAG_HAS_GZIP) || !(session->flags & HTTPSRV_FLAG_ACCEPT_GZIP))
+        {
+            session->response.file = file;
+            return (HTTPSRV_CODE_OK);
+        }
+    }
+
+    /* Compressed copy is stored under the same name with ".gz" appended */
+    length  = strlen(path);
+    gz_path = httpsrv_mem_alloc(length + sizeof(".gz"));
+    if (gz_path == NULL)
+    {
+        session->response.file = file;
+        return ((file != NULL) ? HTTPSRV_CODE_OK : HTTPSRV_CODE_INTERNAL_ERROR);
+    }
+    memcpy(gz_path, path, length);
+    memcpy(gz_path + length, ".gz", sizeof(".gz"));
+
+    session->response.file = HTTPSRV_FS_open(gz_path);
+    httpsrv_mem_free(gz_path);
+    if (session->response.file != NULL)
+    {
+        flags = 0;
+        HTTPSRV_FS_ioctl(session->response.file, IO_IOCTL_HTTPSRV_FS_GET_ATTRIBUTES, &flags);
+        if (!(flags & HTTPSRV_FS_FLAG_GZIP))
+        {
+            /* Plain file which just happens to be named *.gz */
+            HTTPSRV_FS_close(session->response.file);
+            session->response.file = NULL;
+        }
+    }
+
+    if (session->response.file == NULL)
+    {
+        /* Identity copy is used if compressed one is missing */
+        session->response.file = file;
+        return ((file != NULL) ? HTTPSRV_CODE_OK : HTTPSRV_CODE_NOT_FOUND);
+    }
+    if (file != NULL)
+    {
+        HTTPSRV_FS_close(file);
+    }
+    else if (!(session->flags & HTTPSRV_FLAG_ACCEPT_GZIP))
+    {
+        /* Only compressed copy exists and client does not accept it */
+        HTTPSRV_FS_close(session->response.file);
+        session->response.file = NULL;
+        return (HTTPSRV_CODE_NOT_ACCEPTABLE);
+    }
+    return (HTTPSRV_CODE_OK);
+}
+
+/*
+** Check if the copy of opened file cached by client is still valid.
+**
+** IN:
+**      HTTPSRV_SESSION_STRUCT* session - session with file opened
+**
+** OUT:
+**      none
+**
+** Return Value:
+**      int32_t - HTTPSRV_CODE_OK or HTTPSRV_CODE_NOT_MODIFIED.
+*/
+int32_t httpsrv_file_check(HTTPSRV_SESSION_STRUCT *session)
+{
+    char *etag = NULL;
+
+    HTTPSRV_FS_ioctl(session->response.file, IO_IOCTL_HTTPSRV_FS_GET_ETAG, &etag);
+    if ((etag != NULL) && (session->flags & HTTPSRV_FLAG_HAS_IF_NONE_MATCH) &&
+        ((strcmp(session->request.if_none_match, "*") == 0) || (strstr(session->request.if_none_match, etag) != NULL)))
+    {
+        /* Weak comparison, W/ prefix of the tag in request does not matter. Quotes prevent partial match. */
+        return (HTTPSRV_CODE_NOT_MODIFIED);
+    }
+
+    return (HTTPSRV_CODE_OK);
+}
+
+/*
+** Send 304 Not Modified response for static file.
+**
+** IN:
+**      HTTPSRV_SESSION_STRUCT* session - session used for transmission
+**
+** OUT:
+**      none
+**
+** Return Value:
+**      none
+*/
+void httpsrv_send_not_modified(HTTPSRV_SESSION_STRUCT *session)
+{
+    /* Response carries the same cache control as the full one would */
+    httpsrv_process_file_type(strrchr(session->request.path, '.'), session);
+    httpsrv_sendhdr(session, 0, 0);
+}
+
 /*
 ** Convert file extension to content type and determine what kind of cache control should be used.
 **
@@ -883,17 +1036,20 @@ HTTPSRV_SES_STATE httpsrv_sendfile(HTTPSRV_STRUCT *server, HTTPSRV_SESSION_STRUC
         httpsrv_sendhdr(session, HTTPSRV_FS_size(session->response.file), 1);
         HTTPSRV_FS_fseek(session->response.file, session->response.length, HTTPSRV_FS_IO_SEEK_SET);
 
-        length = HTTPSRV_FS_read(session->response.file, buffer + session->buffer.offset,
-                                 HTTPSRV_SES_BUF_SIZE_PRV - session->buffer.offset);
-        //  fread(buffer+session->buffer.offset, 1, HTTPSRV_SES_BUF_SIZE_PRV-session->buffer.offset,
-        //  session->response.file);
-        if (length > 0)
+        if (!httpsrv_send_nocopy(session, &length))
         {
-            session->buffer.offset += length;
-            length = httpsrv_ses_flush(session);
-            if (length != -1)
+            length = HTTPSRV_FS_read(session->response.file, buffer + session->buffer.offset,
+                                     HTTPSRV_SES_BUF_SIZE_PRV - session->buffer.offset);
+            //  fread(buffer+session->buffer.offset, 1, HTTPSRV_SES_BUF_SIZE_PRV-session->buffer.offset,
+            //  session->response.file);
+            if (length > 0)
             {
-                session->response.length += length;
+                session->buffer.offset += length;
+                length = httpsrv_ses_flush(session);
+                if (length != -1)
+                {
+                    session->response.length += length;
+                }
             }
         }
     }
@@ -909,6 +1065,71 @@ HTTPSRV_SES_STATE httpsrv_sendfile(HTTPSRV_STRUCT *server, HTTPSRV_SESSION_STRUC
     return (retval);
 }
 
+/*
+** Send rest of static file straight from file system memory, without copying it to session buffer.
+**
+** IN:
+**      HTTPSRV_SESSION_STRUCT* session - session used for transmission, file position set to data not sent yet
+**
+** OUT:
+**      int* length - number of bytes left to send, zero or negative once response is over
+**
+** Return Value:
+**      bool - false if file shall be sent through session buffer
+*/
+static bool httpsrv_send_nocopy(HTTPSRV_SESSION_STRUCT *session, int *length)
+{
+#if HTTPSRV_CFG_SEND_NOCOPY && defined(MSG_NOCOPY)
+    unsigned char *data = NULL;
+    int flags           = MSG_NOCOPY;
+    int sent;
+
+#if HTTPSRV_CFG_WOLFSSL_ENABLE || HTTPSRV_CFG_MBEDTLS_ENABLE
+    /* TLS library encrypts data into its own buffer */
+    if (session->tls_sock != 0)
+    {
+        return false;
+    }
+#endif
+    if ((HTTPSRV_FS_ioctl(session->response.file, IO_IOCTL_HTTPSRV_FS_GET_CURRENT_DATA_PTR, &data) !=
+         HTTPSRV_FS_OK) ||
+        (data == NULL))
+    {
+        return false;
+    }
+
+    *length = HTTPSRV_FS_size(session->response.file) - session->response.length;
+    if (*length <= 0)
+    {
+        return true;
+    }
+
+#if HTTPSRV_CFG_SINGLE_TASK
+    /* Queue only what fits into socket now, other sessions are served until client acknowledges data */
+    flags |= MSG_DONTWAIT;
+#endif
+    sent = httpsrv_send(session, (const char *)data, *length, flags);
+    if (sent > 0)
+    {
+        session->response.length += sent;
+        *length -= sent;
+    }
+#if HTTPSRV_CFG_SINGLE_TASK
+    else if ((sent < 0) && ((errno == EWOULDBLOCK) || (errno == EAGAIN)))
+    {
+        /* Try again once socket is writable */
+    }
+#endif
+    else
+    {
+        *length = -1;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
 /*
 ** Send extended string to socket (dynamic web pages).
 **
@@ -1285,6 +1506,12 @@ int32_t httpsrv_req_line(HTTPSRV_STRUCT *server, HTTPSRV_SESSION_STRUCT *session
         return (HTTPSRV_ERR);
     }
 
+    /* Connection of HTTP/1.0 request is closed after response unless client asks to keep it alive */
+    if ((uri_end == NULL) || (strcmp(uri_end + 1, "HTTP/1.1") != 0))
+    {
+        session->flags &= ~HTTPSRV_FLAG_IS_KEEP_ALIVE;
+    }
+
     /* Pre-process URI */
     httpsrv_url_decode(uri_begin);
     httpsrv_url_cleanup(uri_begin);
@@ -1366,6 +1593,24 @@ int32_t httpsrv_req_hdr(HTTPSRV_SESSION_STRUCT *session, char *buffer)
         session->request.content_length = (uint32_t)value;
         session->flags |= HTTPSRV_FLAG_HAS_CONTENT_LENGTH;
     }
+    else if (strncmp(buffer, "Accept-Encoding: ", 17) == 0)
+    {
+        param_ptr = buffer + 17;
+        if (httpsrv_accept_gzip(param_ptr))
+        {
+            session->flags |= HTTPSRV_FLAG_ACCEPT_GZIP;
+        }
+    }
+    else if (strncmp(buffer, "If-None-Match: ", 15) == 0)
+    {
+        param_ptr = buffer + 15;
+        /* Value which does not fit is ignored, full response is sent then */
+        if (strlen(param_ptr) < sizeof(session->request.if_none_match))
+        {
+            strcpy(session->request.if_none_match, param_ptr);
+            session->flags |= HTTPSRV_FLAG_HAS_IF_NONE_MATCH;
+        }
+    }
     else if (strncmp(buffer, "Content-Type: ", 14) == 0)
     {
         param_ptr = buffer + 14;
@@ -1466,6 +1711,56 @@ EXIT:
     return (retval);
 }
 
+/*
+** Check if Accept-Encoding field value accepts gzip content coding.
+**
+** IN:
+**      const char* value - field value, comma separated list of codings with optional quality values.
+**
+** OUT:
+**      none
+**
+** Return Value:
+**      bool - true if gzip is listed without zero quality value.
+*/
+static bool httpsrv_accept_gzip(const char *value)
+{
+    while (*value != '\0')
+    {
+        uint32_t length;
+        uint32_t item_length;
+
+        value += strspn(value, " \t,");
+        length      = strcspn(value, " \t;,");
+        item_length = strcspn(value, ",");
+
+        if (((length == 4) && (lwip_strnicmp(value, "gzip", 4) == 0)) ||
+            ((length == 6) && (lwip_strnicmp(value, "x-gzip", 6) == 0)))
+        {
+            const char *q;
+
+            /* Only "q=0", "q=0." or "q=0.000" refuse the coding */
+            q = strstr(value, "q=");
+            if ((q == NULL) || (q >= value + item_length))
+            {
+                return (true);
+            }
+            q += 2;
+            if (*q++ != '0')
+            {
+                return (true);
+            }
+            if (*q == '.')
+            {
+                q += 1 + strspn(q + 1, "0");
+            }
+            return ((*q != '\0') && (*q != ',') && (*q != ' ') && (*q != '\t') && (*q != ';'));
+        }
+        value += item_length;
+    }
+    return (false);
+}
+
 /*
 ** Get realm for requested path
 **
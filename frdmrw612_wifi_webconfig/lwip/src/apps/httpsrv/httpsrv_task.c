@@ -25,6 +25,7 @@ static void httpsrv_plugin_run(void *server_ptr, void *session_ptr);
 #endif
 
 static int httpsrv_req_read(HTTPSRV_STRUCT *server, HTTPSRV_SESSION_STRUCT *session);
+static void httpsrv_ses_keep_alive(HTTPSRV_SESSION_STRUCT *session);
 static HTTPSRV_SES_STATE httpsrv_req_do(HTTPSRV_STRUCT *server, HTTPSRV_SESSION_STRUCT *session);
 static HTTPSRV_SES_STATE httpsrv_response(HTTPSRV_STRUCT *server, HTTPSRV_SESSION_STRUCT *session);
 
@@ -33,8 +34,19 @@ static HTTPSRV_SESSION_STRUCT *httpsrv_ses_alloc(HTTPSRV_STRUCT *server, int soc
 static void httpsrv_ses_free(HTTPSRV_SESSION_STRUCT *session);
 static void httpsrv_ses_close(HTTPSRV_SESSION_STRUCT *session);
 static int httpsrv_ses_init(HTTPSRV_STRUCT *server, HTTPSRV_SESSION_STRUCT *session, const int sock);
+static int httpsrv_ses_sockopt(int sock);
+#if !HTTPSRV_CFG_SINGLE_TASK || HTTPSRV_CFG_WEBSOCKET_ENABLED
 static void httpsrv_session_task(void *arg);
+#endif
+#if HTTPSRV_CFG_SINGLE_TASK
+static void httpsrv_ses_accept(HTTPSRV_STRUCT *server, int i);
+static uint32_t httpsrv_ses_wait_time(HTTPSRV_SESSION_STRUCT *session, uint32_t time_now);
+#if HTTPSRV_CFG_WEBSOCKET_ENABLED
+static void httpsrv_ses_detach(HTTPSRV_STRUCT *server, int i);
+#endif
+#endif
 
+#if !HTTPSRV_CFG_SINGLE_TASK
 /*
  ** HTTPSRV main task which creates new task for each new client request
  */
@@ -73,36 +85,15 @@ void httpsrv_server_task(void *arg)
             }
             else
             {
-#if ((defined(HTTPSRV_CFG_SEND_TIMEOUT) && (HTTPSRV_CFG_SEND_TIMEOUT != 0)) || \
-     (defined(HTTPSRV_CFG_RECEIVE_TIMEOUT) && (HTTPSRV_CFG_RECEIVE_TIMEOUT != 0)))
-                struct timeval timeval_option;
-#endif
-
                 /* Set socket options */
-#if (defined(HTTPSRV_CFG_SEND_TIMEOUT) && (HTTPSRV_CFG_SEND_TIMEOUT != 0))
-                timeval_option.tv_sec  = HTTPSRV_CFG_SEND_TIMEOUT / 1000;          /* seconds */
-                timeval_option.tv_usec = (HTTPSRV_CFG_SEND_TIMEOUT % 1000) * 1000; /* and microseconds */
-                error = lwip_setsockopt(new_sock, SOL_SOCKET, SO_SNDTIMEO, (const void *)&timeval_option,
-                                        sizeof(timeval_option));
-                if (error != 0)
-                {
-                    httpsrv_abort(new_sock);
-                    sys_sem_signal(&server->ses_cnt);
-                    break;
-                }
-#endif
-#if (defined(HTTPSRV_CFG_RECEIVE_TIMEOUT) && (HTTPSRV_CFG_RECEIVE_TIMEOUT != 0))
-                timeval_option.tv_sec  = HTTPSRV_CFG_RECEIVE_TIMEOUT / 1000;          /* seconds */
-                timeval_option.tv_usec = (HTTPSRV_CFG_RECEIVE_TIMEOUT % 1000) * 1000; /* and microseconds */
-                error = lwip_setsockopt(new_sock, SOL_SOCKET, SO_RCVTIMEO, (const void *)&timeval_option,
-                                        sizeof(timeval_option));
+                error = httpsrv_ses_sockopt(new_sock);
                 if (error != 0)
                 {
                     httpsrv_abort(new_sock);
                     sys_sem_signal(&server->ses_cnt);
                     break;
                 }
-#endif
+
                 /* Find empty session */
                 for (i = 0; i < server->params.max_ses; i++)
                 {
@@ -133,7 +124,7 @@ void httpsrv_server_task(void *arg)
                                  * by keep-alive timeout) */
                                 if (i == server->params.max_ses - 1)
                                 {
-                                    session->flags &= ~HTTPSRV_FLAG_KEEP_ALIVE_ENABLED;
+                                    session->flags &= ~(HTTPSRV_FLAG_KEEP_ALIVE_ENABLED | HTTPSRV_FLAG_IS_KEEP_ALIVE);
                                 }
 
                                 server->session[i] = session;
@@ -197,6 +188,327 @@ void httpsrv_server_task(void *arg)
     vTaskDelete(NULL);
 }
 
+#else /* HTTPSRV_CFG_SINGLE_TASK */
+
+/*
+ ** HTTPSRV main task which runs state machines of all sessions.
+ ** Session is processed once its socket is ready for the I/O the state waits for,
+ ** so no session blocks the others while waiting for client.
+ */
+void httpsrv_server_task(void *arg)
+{
+    HTTPSRV_STRUCT *server = (HTTPSRV_STRUCT *)arg;
+    int i;
+
+    while (server->valid != HTTPSRV_INVALID)
+    {
+        fd_set readset;
+        fd_set writeset;
+        struct timeval timeout;
+        uint32_t wait_time = HTTPSRV_CFG_SES_TIMEOUT;
+        uint32_t time_now  = sys_now();
+        int free_slot      = -1;
+        int max_sock       = -1;
+        int result;
+
+        FD_ZERO(&readset);
+        FD_ZERO(&writeset);
+
+        for (i = 0; i < server->params.max_ses; i++)
+        {
+            HTTPSRV_SESSION_STRUCT *session = server->session[i];
+            uint32_t ses_wait_time;
+
+            if (session == NULL)
+            {
+                /* Lowest free slot is used, the last one is kept for clients without keep-alive */
+                if (free_slot == -1)
+                {
+                    free_slot = i;
+                }
+                continue;
+            }
+            /* Session run by its own task */
+            if (session->process_func != httpsrv_http_process)
+            {
+                continue;
+            }
+
+            switch (session->state)
+            {
+                case HTTPSRV_SES_WAIT_REQ:
+                    if (session->flags & HTTPSRV_FLAG_IS_PIPELINED)
+                    {
+                        /* Request is already in buffer */
+                        ses_wait_time = 0;
+                        break;
+                    }
+                    FD_SET(session->sock, &readset);
+                    ses_wait_time = httpsrv_ses_wait_time(session, time_now);
+                    break;
+                case HTTPSRV_SES_RESP:
+                    FD_SET(session->sock, &writeset);
+                    ses_wait_time = httpsrv_ses_wait_time(session, time_now);
+                    break;
+                default:
+                    /* State does not wait for client */
+                    ses_wait_time = 0;
+                    break;
+            }
+            if (ses_wait_time < wait_time)
+            {
+                wait_time = ses_wait_time;
+            }
+            if (session->sock > max_sock)
+            {
+                max_sock = session->sock;
+            }
+        }
+
+        /* New connections wait in listen backlog until session is free */
+        if (free_slot != -1)
+        {
+            FD_SET(server->sock, &readset);
+            if (server->sock > max_sock)
+            {
+                max_sock = server->sock;
+            }
+        }
+
+        timeout.tv_sec  = wait_time / 1000;
+        timeout.tv_usec = (wait_time % 1000) * 1000;
+        result          = lwip_select(max_sock + 1, &readset, &writeset, NULL, &timeout);
+        if (server->valid == HTTPSRV_INVALID)
+        {
+            break;
+        }
+        if (result < 0)
+        {
+            /* Sets are undefined on error, only sessions not waiting for client and timed out ones run */
+            FD_ZERO(&readset);
+            FD_ZERO(&writeset);
+            sys_msleep(10);
+        }
+
+        time_now = sys_now();
+        for (i = 0; i < server->params.max_ses; i++)
+        {
+            HTTPSRV_SESSION_STRUCT *session = server->session[i];
+
+            if ((session == NULL) || (session->process_func != httpsrv_http_process))
+            {
+                continue;
+            }
+
+            if (((session->state == HTTPSRV_SES_WAIT_REQ) && !(session->flags & HTTPSRV_FLAG_IS_PIPELINED) &&
+                 !FD_ISSET(session->sock, &readset)) ||
+                ((session->state == HTTPSRV_SES_RESP) && !FD_ISSET(session->sock, &writeset)))
+            {
+                if (httpsrv_ses_wait_time(session, time_now) != 0)
+                {
+                    continue;
+                }
+            }
+
+            /* Run state machine for session */
+            session->process_func(server, session);
+
+            if (!session->valid)
+            {
+                httpsrv_ses_close(session);
+                httpsrv_ses_free(session);
+                server->session[i] = NULL;
+            }
+#if HTTPSRV_CFG_WEBSOCKET_ENABLED
+            else if (session->process_func != httpsrv_http_process)
+            {
+                /* WebSocket session blocks in its plugin, it gets its own task */
+                httpsrv_ses_detach(server, i);
+            }
+#endif
+        }
+
+        if ((free_slot != -1) && (result > 0) && FD_ISSET(server->sock, &readset))
+        {
+            httpsrv_ses_accept(server, free_slot);
+        }
+    }
+
+    /* Release sessions run by this task, httpsrv_destroy_server() waits for the rest */
+    for (i = 0; i < server->params.max_ses; i++)
+    {
+        HTTPSRV_SESSION_STRUCT *session = server->session[i];
+
+        if ((session != NULL) && (session->process_func == httpsrv_http_process))
+        {
+            httpsrv_ses_close(session);
+            httpsrv_ses_free(session);
+            server->session[i] = NULL;
+        }
+    }
+
+    /* Server release.*/
+    httpsrv_destroy_server(server);
+    server->server_tid = 0;
+    sys_sem_signal(&server->finished);
+
+    vTaskDelete(NULL);
+}
+
+/*
+ ** Accept new connection into free session slot.
+ **
+ ** IN:
+ **      HTTPSRV_STRUCT *server - pointer to server structure.
+ **      int i - index of free session slot.
+ **
+ ** OUT:
+ **      none
+ **
+ ** Return Value:
+ **      none
+ */
+static void httpsrv_ses_accept(HTTPSRV_STRUCT *server, int i)
+{
+    HTTPSRV_SESSION_STRUCT *session;
+    int new_sock;
+
+    new_sock = httpsrv_accept(server->sock);
+    if (new_sock < 0)
+    {
+        return;
+    }
+
+    if (httpsrv_ses_sockopt(new_sock) != 0)
+    {
+        httpsrv_abort(new_sock);
+        return;
+    }
+
+    session = httpsrv_ses_alloc(server, new_sock);
+    if (session == NULL)
+    {
+        httpsrv_abort(new_sock);
+        return;
+    }
+
+    if (ERR_OK != httpsrv_ses_init(server, session, new_sock))
+    {
+        httpsrv_ses_close(session);
+        httpsrv_ses_free(session);
+        return;
+    }
+
+    /* Disable keep-alive for last session so idle keep-alive sessions do not hold off new clients */
+    if (i == server->params.max_ses - 1)
+    {
+        session->flags &= ~(HTTPSRV_FLAG_KEEP_ALIVE_ENABLED | HTTPSRV_FLAG_IS_KEEP_ALIVE);
+    }
+
+    server->session[i] = session;
+}
+
+/*
+ ** Get time session may wait for its socket before it times out.
+ **
+ ** IN:
+ **      HTTPSRV_SESSION_STRUCT* session - session structure pointer.
+ **      uint32_t time_now - current time in ms.
+ **
+ ** OUT:
+ **      none
+ **
+ ** Return Value:
+ **      uint32_t - time in ms, zero if session already timed out.
+ */
+static uint32_t httpsrv_ses_wait_time(HTTPSRV_SESSION_STRUCT *session, uint32_t time_now)
+{
+    uint32_t elapsed = time_now - session->time;
+
+    /* State machine closes session on timeout expiration, that is once elapsed time exceeds it */
+    return (elapsed > session->timeout) ? 0 : (session->timeout - elapsed + 1);
+}
+
+#if HTTPSRV_CFG_WEBSOCKET_ENABLED
+/*
+ ** Hand session over to its own task.
+ **
+ ** IN:
+ **      HTTPSRV_STRUCT *server - pointer to server structure.
+ **      int i - index of session slot.
+ **
+ ** OUT:
+ **      none
+ **
+ ** Return Value:
+ **      none
+ */
+static void httpsrv_ses_detach(HTTPSRV_STRUCT *server, int i)
+{
+    HTTPSRV_SESSION_STRUCT *session = server->session[i];
+    HTTPSRV_SES_TASK_PARAM *ses_param;
+
+    ses_param = httpsrv_mem_alloc_zero(sizeof(HTTPSRV_SES_TASK_PARAM));
+    if (ses_param != NULL)
+    {
+        ses_param->server    = server;
+        ses_param->session_p = &server->session[i];
+
+        /* Session task frees the slot when it ends */
+        if (xTaskCreate(httpsrv_session_task, HTTPSRV_SESSION_TASK_NAME, HTTPSRV_CFG_HTTP_SESSION_STACK_SIZE,
+                        ses_param, server->params.task_prio, NULL) == pdPASS)
+        {
+            return;
+        }
+        httpsrv_mem_free(ses_param);
+    }
+
+    httpsrv_ses_close(session);
+    httpsrv_ses_free(session);
+    server->session[i] = NULL;
+}
+#endif /* HTTPSRV_CFG_WEBSOCKET_ENABLED */
+
+#endif /* HTTPSRV_CFG_SINGLE_TASK */
+
+/*
+ ** Set timeouts of session socket.
+ **
+ ** IN:
+ **      int sock - session socket.
+ **
+ ** OUT:
+ **      none
+ **
+ ** Return Value:
+ **      int - zero on success.
+ */
+static int httpsrv_ses_sockopt(int sock)
+{
+    int error = 0;
+#if ((defined(HTTPSRV_CFG_SEND_TIMEOUT) && (HTTPSRV_CFG_SEND_TIMEOUT != 0)) || \
+     (defined(HTTPSRV_CFG_RECEIVE_TIMEOUT) && (HTTPSRV_CFG_RECEIVE_TIMEOUT != 0)))
+    struct timeval timeval_option;
+#endif
+
+#if (defined(HTTPSRV_CFG_SEND_TIMEOUT) && (HTTPSRV_CFG_SEND_TIMEOUT != 0))
+    timeval_option.tv_sec  = HTTPSRV_CFG_SEND_TIMEOUT / 1000;          /* seconds */
+    timeval_option.tv_usec = (HTTPSRV_CFG_SEND_TIMEOUT % 1000) * 1000; /* and microseconds */
+    error = lwip_setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, (const void *)&timeval_option, sizeof(timeval_option));
+    if (error != 0)
+    {
+        return error;
+    }
+#endif
+#if (defined(HTTPSRV_CFG_RECEIVE_TIMEOUT) && (HTTPSRV_CFG_RECEIVE_TIMEOUT != 0))
+    timeval_option.tv_sec  = HTTPSRV_CFG_RECEIVE_TIMEOUT / 1000;          /* seconds */
+    timeval_option.tv_usec = (HTTPSRV_CFG_RECEIVE_TIMEOUT % 1000) * 1000; /* and microseconds */
+    error = lwip_setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, (const void *)&timeval_option, sizeof(timeval_option));
+#endif
+    return error;
+}
+
+#if !HTTPSRV_CFG_SINGLE_TASK || HTTPSRV_CFG_WEBSOCKET_ENABLED
 /*
  ** Session task.
  ** This task is responsible for session creation, processing and cleanup.
@@ -222,6 +534,7 @@ static void httpsrv_session_task(void *arg)
     sys_sem_signal(&server->ses_cnt);
     vTaskDelete(NULL);
 }
+#endif
 
 /*
  ** Function for session allocation
@@ -318,6 +631,10 @@ static void httpsrv_ses_free(HTTPSRV_SESSION_STRUCT *session)
         {
             httpsrv_mem_free(session->buffer.data);
         }
+        if (session->pipeline.data)
+        {
+            httpsrv_mem_free(session->pipeline.data);
+        }
 #if (defined(HTTPSRV_CFG_WEBSOCKET_ENABLED) && (HTTPSRV_CFG_WEBSOCKET_ENABLED != 0))
         if (session->ws_handshake)
         {
@@ -460,6 +777,7 @@ void httpsrv_http_process(void *server_ptr, void *session_ptr)
             }
             else if ((result == HTTPSRV_OK) && !(session->flags & HTTPSRV_FLAG_PROCESS_HEADER))
             {
+                httpsrv_ses_keep_alive(session);
                 session->response.status_code = httpsrv_req_check(session);
                 if (session->response.status_code != HTTPSRV_CODE_OK)
                 {
@@ -481,12 +799,16 @@ void httpsrv_http_process(void *server_ptr, void *session_ptr)
             break;
 
         case HTTPSRV_SES_END_REQ:
-            if (!(session->flags & HTTPSRV_FLAG_IS_KEEP_ALIVE))
+            /* Unread request body would be taken for next request */
+            if (!(session->flags & HTTPSRV_FLAG_IS_KEEP_ALIVE) ||
+                ((session->request.method == HTTPSRV_REQ_POST) && (session->request.content_length != 0)))
             {
                 httpsrv_ses_set_state(session, HTTPSRV_SES_CLOSE);
             }
             else
             {
+                char *path;
+
                 /* Re-init session */
                 httpsrv_ses_set_state(session, HTTPSRV_SES_WAIT_REQ);
                 if (session->response.file)
@@ -499,11 +821,25 @@ void httpsrv_http_process(void *server_ptr, void *session_ptr)
                 {
                     httpsrv_mem_free(session->request.auth.user_id);
                 }
-                session->request.auth.user_id  = NULL;
-                session->request.auth.password = NULL;
-                session->time                  = sys_now();
-                session->timeout               = HTTPSRV_CFG_KEEPALIVE_TIMEOUT;
-                session->flags                 = HTTPSRV_FLAG_IS_KEEP_ALIVE | HTTPSRV_FLAG_PROCESS_HEADER;
+                path = session->request.path;
+                memset(&session->request, 0, sizeof(session->request));
+                session->request.path = path;
+                session->time         = sys_now();
+                session->timeout      = HTTPSRV_CFG_KEEPALIVE_TIMEOUT;
+                session->flags &= HTTPSRV_FLAG_KEEP_ALIVE_ENABLED;
+                session->flags |= HTTPSRV_FLAG_IS_KEEP_ALIVE | HTTPSRV_FLAG_PROCESS_HEADER;
+
+                /* Pipelined request is parsed without waiting for socket */
+                session->buffer.offset = 0;
+                if (session->pipeline.data != NULL)
+                {
+                    memcpy(session->buffer.data, session->pipeline.data, session->pipeline.offset);
+                    session->buffer.offset = session->pipeline.offset;
+                    httpsrv_mem_free(session->pipeline.data);
+                    session->pipeline.data   = NULL;
+                    session->pipeline.offset = 0;
+                    session->flags |= HTTPSRV_FLAG_IS_PIPELINED;
+                }
             }
             break;
         case HTTPSRV_SES_CLOSE:
@@ -529,61 +865,63 @@ void httpsrv_http_process(void *server_ptr, void *session_ptr)
 static int httpsrv_req_read(HTTPSRV_STRUCT *server, HTTPSRV_SESSION_STRUCT *session)
 {
     char *line_start;
+    char *line_end;
+    char *data_end;
     int read;
     int retval;
-    char *line_end;
-    uint32_t unprocessed_size;
 
     line_start = session->buffer.data;
-    line_end   = NULL;
     retval     = HTTPSRV_OK;
 
-    /* Read data */
-    read = httpsrv_recv(session, session->buffer.data + session->buffer.offset,
-                        HTTPSRV_SES_BUF_SIZE_PRV - session->buffer.offset, 0);
-    if (read < 1) /* 0 means connection is closed.*/
+    /* Pipelined request already in buffer is parsed first, socket is read once it is incomplete */
+    if (session->flags & HTTPSRV_FLAG_IS_PIPELINED)
     {
-        int optval;
-        socklen_t optlen = sizeof(optval);
-
-        if ((lwip_getsockopt(session->sock, SOL_SOCKET, SO_ERROR, &optval, &optlen) == 0) && (optval == EWOULDBLOCK))
-        {
-            retval = HTTPSRV_OK;
-        }
-        else
+        session->flags &= ~HTTPSRV_FLAG_IS_PIPELINED;
+        read = 0;
+    }
+    else
+    {
+        /* Read data */
+        read = httpsrv_recv(session, session->buffer.data + session->buffer.offset,
+                            HTTPSRV_SES_BUF_SIZE_PRV - session->buffer.offset, 0);
+        if (read < 1) /* 0 means connection is closed.*/
         {
-            retval = HTTPSRV_ERR;
+            if ((read < 0) && ((errno == EWOULDBLOCK) || (errno == EAGAIN)))
+            {
+                retval = HTTPSRV_OK;
+            }
+            else
+            {
+                retval = HTTPSRV_ERR;
+            }
+            goto EXIT;
         }
-        goto EXIT;
     }
+    data_end = session->buffer.data + session->buffer.offset + read;
+    /* Client is sending request, keep-alive timeout does not apply anymore */
+    session->timeout = HTTPSRV_CFG_SES_TIMEOUT;
 
-    unprocessed_size = read;
     /* Process buffer line by line. End of line is \n or \r\n */
-    while (1)
+    while ((line_end = memchr(line_start, (int)'\n', data_end - line_start)) != NULL)
     {
-        uint32_t max_length;
-
-        max_length = (session->buffer.data + HTTPSRV_SES_BUF_SIZE_PRV) - line_start;
-        line_end   = memchr(line_start, (int)'\n', max_length);
-        if (line_end == NULL)
-        {
-            break;
-        }
-
         /* Null terminate the line */
         *line_end = '\0';
-        if ((line_end != session->buffer.data) && (*(line_end - 1) == '\r'))
+        if ((line_end != line_start) && (*(line_end - 1) == '\r'))
         {
             *(line_end - 1) = '\0';
         }
         session->request.lines++;
-        /* Subtract line length from size of unprocessed data */
-        unprocessed_size -= (line_end - line_start + 1) - session->request.pending;
-        session->request.pending = 0;
 
         /* Found an empty line => end of header */
-        if (strlen(line_start) == 0)
+        if (line_start[0] == '\0')
         {
+            line_start = line_end + 1;
+            /* Empty lines in front of request line are ignored */
+            if (session->request.lines == 1)
+            {
+                session->request.lines = 0;
+                continue;
+            }
             session->flags &= ~HTTPSRV_FLAG_PROCESS_HEADER;
             session->request.lines = 0;
             break;
@@ -593,8 +931,7 @@ static int httpsrv_req_read(HTTPSRV_STRUCT *server, HTTPSRV_SESSION_STRUCT *sess
         {
             if (httpsrv_req_line(server, session, line_start) != HTTPSRV_OK)
             {
-                session->buffer.offset = 0;
-                retval                 = HTTPSRV_FAIL;
+                retval = HTTPSRV_FAIL;
                 goto EXIT;
             }
         }
@@ -602,52 +939,76 @@ static int httpsrv_req_read(HTTPSRV_STRUCT *server, HTTPSRV_SESSION_STRUCT *sess
         {
             if (httpsrv_req_hdr(session, line_start) != HTTPSRV_OK)
             {
-                session->buffer.offset = 0;
-                retval                 = HTTPSRV_FAIL;
+                retval = HTTPSRV_FAIL;
                 goto EXIT;
             }
         }
         /* Set start of next line after end of current line */
         line_start = line_end + 1;
-        /* Check buffer boundary */
-        if (line_start > (session->buffer.data + HTTPSRV_SES_BUF_SIZE_PRV))
-        {
-            line_start = session->buffer.data + HTTPSRV_SES_BUF_SIZE_PRV;
-        }
     }
 
-    session->request.pending += unprocessed_size;
-    if (session->request.pending >= HTTPSRV_SES_BUF_SIZE_PRV)
+    /* Move unprocessed data (incomplete line, request body or pipelined request) at the beginning of buffer. */
+    session->buffer.offset = data_end - line_start;
+    if ((session->flags & HTTPSRV_FLAG_PROCESS_HEADER) && (session->buffer.offset >= HTTPSRV_SES_BUF_SIZE_PRV))
     {
         session->response.status_code = HTTPSRV_CODE_FIELD_TOO_LARGE;
-        session->buffer.offset        = 0;
         retval                        = HTTPSRV_FAIL;
         goto EXIT;
     }
-
-    /* There were no valid lines in buffer */
-    if ((unprocessed_size >= HTTPSRV_SES_BUF_SIZE_PRV) && (session->request.lines == 0))
+    memmove(session->buffer.data, line_start, session->buffer.offset);
+EXIT:
+    if (retval == HTTPSRV_FAIL)
     {
+        /* Rest of the request can not be told apart from next one */
         session->buffer.offset = 0;
+        session->flags &= ~HTTPSRV_FLAG_IS_KEEP_ALIVE;
+    }
+    return (retval);
+}
+
+/*
+ ** Prepare session for response to request which header was read.
+ ** Checks if connection is kept open after the response and puts pipelined request aside,
+ ** as the response is built in session buffer.
+ **
+ ** IN:
+ **      HTTPSRV_SESSION_STRUCT* session - session structure pointer.
+ **
+ ** OUT:
+ **      none
+ **
+ ** Return Value:
+ **      none
+ */
+static void httpsrv_ses_keep_alive(HTTPSRV_SESSION_STRUCT *session)
+{
+    session->requests++;
+    if (session->requests >= HTTPSRV_CFG_KEEPALIVE_MAX_REQUESTS)
+    {
+        session->flags &= ~HTTPSRV_FLAG_IS_KEEP_ALIVE;
+    }
+
+    /* Data following header of POST request is its body read by CGI */
+    if ((session->buffer.offset == 0) || (session->request.method == HTTPSRV_REQ_POST))
+    {
+        return;
     }
-    /* If there are some unprocessed data, move it at the beginning of buffer/set correct buffer offset. */
-    else if (unprocessed_size != 0)
+
+    if (session->flags & HTTPSRV_FLAG_IS_KEEP_ALIVE)
     {
-        /* Copy rest of data to beginning of buffer and save offset for next reading. */
-        if (line_end != NULL)
+        session->pipeline.data = httpsrv_mem_alloc(session->buffer.offset);
+        if (session->pipeline.data != NULL)
         {
-            memmove(session->buffer.data, line_end + 1, unprocessed_size);
+            memcpy(session->pipeline.data, session->buffer.data, session->buffer.offset);
+            session->pipeline.offset = session->buffer.offset;
         }
         else
         {
-            memmove(session->buffer.data, line_start, unprocessed_size);
+            /* Client repeats pipelined requests not answered before connection is closed */
+            session->flags &= ~HTTPSRV_FLAG_IS_KEEP_ALIVE;
         }
-        session->buffer.offset = unprocessed_size;
     }
-    /* Clear the buffer so we don't have some old data there. */
-    memset(session->buffer.data + session->buffer.offset, 0, HTTPSRV_SES_BUF_SIZE_PRV - session->buffer.offset);
-EXIT:
-    return (retval);
+    session->buffer.offset = 0;
 }
 
 /*
@@ -752,11 +1113,11 @@ static HTTPSRV_SES_STATE httpsrv_req_do(HTTPSRV_STRUCT *server, HTTPSRV_SESSION_
         goto EXIT;
     }
 
-    session->response.file   = HTTPSRV_FS_open(full_path);
-    session->response.length = 0;
-    if (!session->response.file)
+    session->response.length      = 0;
+    session->response.status_code = httpsrv_file_open(session, full_path);
+    if (session->response.status_code == HTTPSRV_CODE_OK)
     {
-        session->response.status_code = HTTPSRV_CODE_NOT_FOUND;
+        session->response.status_code = httpsrv_file_check(session);
     }
     httpsrv_mem_free(full_path);
 
@@ -807,6 +1168,9 @@ static HTTPSRV_SES_STATE httpsrv_response(HTTPSRV_STRUCT *server, HTTPSRV_SESSIO
                 retval = httpsrv_sendfile(server, session);
             }
             break;
+        case HTTPSRV_CODE_NOT_MODIFIED:
+            httpsrv_send_not_modified(session);
+            break;
         case HTTPSRV_CODE_UNAUTHORIZED:
             httpsrv_send_err_page(session, "Unauthorized", "Unauthorized!");
             break;
@@ -823,6 +1187,9 @@ static HTTPSRV_SES_STATE httpsrv_response(HTTPSRV_STRUCT *server, HTTPSRV_SESSIO
         case HTTPSRV_CODE_METHOD_NOT_ALLOWED:
             httpsrv_send_err_page(session, "Method Not Allowed", "POST on static content is not allowed!");
             break;
+        case HTTPSRV_CODE_NOT_ACCEPTABLE:
+            httpsrv_send_err_page(session, "Not Acceptable", "Requested URL is available gzip encoded only!");
+            break;
         default:
             session->flags &= ~HTTPSRV_FLAG_IS_KEEP_ALIVE;
             httpsrv_sendhdr(session, 0, 0);
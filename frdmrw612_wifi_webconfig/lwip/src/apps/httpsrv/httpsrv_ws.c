@@ -40,7 +40,7 @@ static uint32_t ws_check_utf8(WS_CONTEXT_STRUCT *context, uint8_t *data, uint32_
 static uint32_t ws_validate_data(WS_CONTEXT_STRUCT *context);
 static bool ws_check_utf8_finalize(uint8_t *data);
 static uint32_t ws_recv(WS_CONTEXT_STRUCT *context);
-static uint32_t ws_recv_fail(WS_CONTEXT_STRUCT *context);
+static uint32_t ws_recv_fail(WS_CONTEXT_STRUCT *context, int received_size);
 static uint32_t ws_init(HTTPSRV_SESSION_STRUCT *session, WS_CONTEXT_STRUCT **context_out);
 static void ws_deinit(WS_CONTEXT_STRUCT *context);
 static uint32_t ws_process(WS_CONTEXT_STRUCT *context);
@@ -221,7 +221,7 @@ static uint32_t ws_recv(WS_CONTEXT_STRUCT *context)
 {
     WS_FRAME_STRUCT *frame;
     WS_BUFFER_STRUCT *buffer;
-    uint32_t received_size;
+    int received_size;
     uint32_t req_length;
 
     buffer                 = context->actual_buffer;
@@ -254,7 +254,7 @@ static uint32_t ws_recv(WS_CONTEXT_STRUCT *context)
         received_size = httpsrv_recv(context->session, (char *)(buffer->data + buffer->offset), size, 0);
         if (received_size < 1) /* 0 means connection is closed.*/
         {
-            return (ws_recv_fail(context));
+            return (ws_recv_fail(context, received_size));
         }
 
         buffer->offset += received_size;
@@ -303,17 +303,14 @@ static uint32_t ws_recv(WS_CONTEXT_STRUCT *context)
 /*
  * Receive from socket failed.
  */
-static uint32_t ws_recv_fail(WS_CONTEXT_STRUCT *context)
+static uint32_t ws_recv_fail(WS_CONTEXT_STRUCT *context, int received_size)
 {
     const WS_PLUGIN_STRUCT *plugin;
-    int optval;
-    socklen_t optlen = sizeof(optval);
 
     plugin = context->session->plugin;
 
     /* If receive timed out and ping was not send, send it */
-    if (((lwip_getsockopt(context->session->sock, SOL_SOCKET, SO_ERROR, &optval, &optlen) == 0) &&
-         (optval == EWOULDBLOCK)) &&
+    if ((received_size < 0) && ((errno == EWOULDBLOCK) || (errno == EAGAIN)) &&
         (context->state != WS_STATE_WAIT_PONG))
     {
         ws_send_control_frame(context, (uint8_t *)WS_PING_STRING, strlen(WS_PING_STRING), WS_OPCODE_PING);
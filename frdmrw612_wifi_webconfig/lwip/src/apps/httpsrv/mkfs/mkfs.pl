@@ -36,23 +36,39 @@
 # (pages, pictures, ...) in C constant arrays. Separate C files can be created for selected
 # input files.
 #
+# With -z option gzip compressed copy of each file is stored next to it under
+# the same name with .gz appended, if it makes the file smaller. Server side
+# include pages are never compressed. HTTPSRV sends the compressed copy to
+# clients accepting gzip Content-Encoding and the original to the others.
+# Every file gets strong entity tag for conditional requests.
+#
+# Script also generates hash index httpsrv_fs_index of the files with paths
+# normalized the same way HTTPSRV_FS compares them. Pass it to
+# HTTPSRV_FS_init_index() to look files up without walking the directory.
+#
 # Perl:
-# 	perl mkfs.pl -s <separate_file> <input directory>
+# 	perl mkfs.pl [-z] -s <separate_file> <input directory>
 #
-# 	Example: perl mkfs.pl -s image.bmp my_web
+# 	Example: perl mkfs.pl -z -s image.bmp my_web
 
 
 use File::Find;
 use File::Compare;
+use IO::Compress::Gzip qw(gzip $GzipError);
+use Digest::MD5 qw(md5_hex);
 
 
 # Get input
 
 %SEPARATE_FILES = ();
 $INPUT_DIR = "";
+$COMPRESS = 0;
 while(@ARGV)
 {
-  if ($ARGV[0] =~ /^-s$/)
+  if ($ARGV[0] =~ /^-z$/)
+  {
+    $COMPRESS = 1;
+  } elsif ($ARGV[0] =~ /^-s$/)
   {
     shift @ARGV;
     if (@ARGV == 0) { last; }
@@ -74,11 +90,12 @@ if (($INPUT_DIR =~ /^$/) || (@ARGV))
   my $readme =
       "\tThis tool creates C language source file httpsrv_fs_data.c with\n".
       "\tconstant arrays of binary data of all input directory files.\n".
-      "\tData of selected files can be stored in separate C files.\n";
+      "\tData of selected files can be stored in separate C files.\n".
+      "\tWith -z gzip compressed copies are added where it saves space.\n";
 
   print "$readme\n";
   print "Usage:\n";
-  print "mkfs.pl [-s <separate_file>] <input_directory>\n";
+  print "mkfs.pl [-z] [-s <separate_file>] <input_directory>\n";
   exit(0);
 }
 
@@ -86,19 +103,33 @@ if (($INPUT_DIR =~ /^$/) || (@ARGV))
 
 @INPUT_FILES = ();
 find (\&get_files, $INPUT_DIR);
+# Same output regardless of the order of the directory listing
+@INPUT_FILES = sort { lc($a) cmp lc($b) } @INPUT_FILES;
+
+# Load and compress input files
+
+%FILE_DATA = ();
+%FILE_FLAGS = ();
+@ENTRIES = ();
+foreach $file (@INPUT_FILES)
+{
+  &load_file($file);
+}
+@INPUT_FILES = @ENTRIES;
 
 # Open httpsrv_fs_data.tmp for writing
 
 open(OUTPUT, "> httpsrv_fs_data.tmp") or die "Can't create temporary file httpsrv_fs_data.tmp!\n";
 print(OUTPUT "#include <httpsrv_fs.h>\n\n");
-print(OUTPUT "extern const HTTPSRV_FS_DIR_ENTRY httpsrv_fs_data[];\n\n");
+print(OUTPUT "extern const HTTPSRV_FS_DIR_ENTRY httpsrv_fs_data[];\n");
+print(OUTPUT "extern const HTTPSRV_FS_INDEX httpsrv_fs_index;\n\n");
 foreach $file (@INPUT_FILES)
 {
   $fvar = "httpsrv_fs_" . $file;
   $fvar =~ s#[/\.]#_#g;
   if ($SEPARATE_FILES{$file})
   {
-    $size = -s $file;
+    $size = length($FILE_DATA{$file});
     print(OUTPUT "extern const unsigned char " . $fvar . "[$size];\n\n");
   }
 }
@@ -122,10 +153,39 @@ foreach $file (@INPUT_FILES)
   $fvar =~ s#[/\.]#_#g;
   $dest = $file;
   $dest =~ s/^$INPUT_DIR//;
-  print(OUTPUT "\t{ \"${dest}\", 0, ");
-  print(OUTPUT "(unsigned char*)${fvar}, sizeof(${fvar}) },\n");
+  $etag = substr(md5_hex($FILE_DATA{$file}), 0, 16);
+  print(OUTPUT "\t{ \"${dest}\", $FILE_FLAGS{$file}, ");
+  print(OUTPUT "(unsigned char*)${fvar}, sizeof(${fvar}), \"\\\"${etag}\\\"\" },\n");
+}
+print(OUTPUT "\t{ 0, 0, 0, 0, 0 }\n};\n\n");
+
+# Generate hash index, at least twice as many slots as files
+
+$slots = 2;
+while ($slots < 2 * @INPUT_FILES) { $slots *= 2; }
+@INDEX = ();
+%INDEXED = ();
+$entry = 0;
+foreach $file (@INPUT_FILES)
+{
+  $entry++;
+  $dest = $file;
+  $dest =~ s/^$INPUT_DIR//;
+  $name = &normalize_path($dest);
+  # The first of the files differing only in case is found, as when walking the directory
+  if ($INDEXED{$name}) { next; }
+  $INDEXED{$name} = 1;
+  $hash = &hash_path($name);
+  for ($i = $hash & ($slots - 1); defined($INDEX[$i]); $i = ($i + 1) & ($slots - 1)) { }
+  $INDEX[$i] = sprintf("{ 0x%08x, \"%s\", %d }", $hash, $name, $entry);
+}
+print(OUTPUT "static const HTTPSRV_FS_INDEX_SLOT httpsrv_fs_index_slots[$slots] = {\n");
+for ($i = 0; $i < $slots; $i++)
+{
+  print(OUTPUT "\t" . (defined($INDEX[$i]) ? $INDEX[$i] : "{ 0, 0, 0 }") . ",\n");
 }
-print(OUTPUT "\t{ 0, 0, 0, 0 }\n};\n\n");
+print(OUTPUT "};\n\n");
+print(OUTPUT "const HTTPSRV_FS_INDEX httpsrv_fs_index = { httpsrv_fs_data, httpsrv_fs_index_slots, " . ($slots - 1) . " };\n\n");
 close(OUTPUT);
 
 # Rename temporary to *.c files
@@ -169,6 +229,65 @@ sub get_files
 }
 
 
+# Same normalization as HTTPSRV_FS uses for comparing paths
+sub normalize_path
+{
+  my ($path) = @_;
+
+  $path =~ s#\\#/#g;
+  $path =~ tr/a-z/A-Z/;
+  return $path;
+}
+
+
+# FNV-1a hash, must match HTTPSRV_FS_HASH_STEP
+sub hash_path
+{
+  use integer;
+  my ($path) = @_;
+  my $hash = 2166136261;
+
+  foreach (split(//, $path))
+  {
+    $hash = (($hash ^ ord($_)) * 16777619) & 0xFFFFFFFF;
+  }
+  return $hash;
+}
+
+
+# Reads file, compresses it if requested and worth it
+sub load_file
+{
+  my ($file) = @_;
+  my ($data, $gz);
+
+  open(FILE, $file) or die "Can't open file ${file}!\n";
+  binmode(FILE);
+  local $/;
+  $data = <FILE>;
+  close(FILE);
+
+  $FILE_DATA{$file} = $data;
+  $FILE_FLAGS{$file} = 0;
+  @ENTRIES = (@ENTRIES, $file);
+  # Server side includes are processed on the fly, they stay uncompressed
+  if ($COMPRESS && ($file !~ /\.shtml?$/i))
+  {
+    # No file name and time stamp in the header, output depends on the content only
+    gzip(\$data => \$gz, -Level => 9, Minimal => 1) or die "Can't compress file ${file}: $GzipError\n";
+    if (length($gz) < length($data))
+    {
+      die "Can't store compressed copy of ${file}, ${file}.gz exists!\n" if (-e "${file}.gz");
+      $FILE_DATA{"${file}.gz"} = $gz;
+      $FILE_FLAGS{"${file}.gz"} = 4; # HTTPSRV_FS_FLAG_GZIP
+      $FILE_FLAGS{$file} = 8; # HTTPSRV_FS_FLAG_HAS_GZIP
+      @ENTRIES = (@ENTRIES, "${file}.gz");
+      printf("Compressed file %s %d -> %d\n", $file, length($data), length($gz));
+    }
+  }
+}
+
+
 sub check_write_protect
 {
   my ($file) = @_;
@@ -192,10 +311,6 @@ sub process_file
 {
   my ($file, $fvar, $separate) = @_;
 
-  open(FILE, $file) or die "Can't open file ${file}!\n";
-
-  binmode(FILE);
-
   $output = "OUTPUT";
   if ($separate)
   {
@@ -210,14 +325,12 @@ sub process_file
   print($output "\t/* $file */\n");
 
   $sep = "\t";
-  while(read(FILE, $data, 10, 0))
+  $count = 0;
+  foreach(split(//, $FILE_DATA{$file}))
   {
-    foreach(split(//, $data))
-    {
-      printf($output "${sep}0x%02x", ord($_));
-      $sep = ", ";
-    }
-    $sep = ",\n\t";
+    printf($output "${sep}0x%02x", ord($_));
+    $count++;
+    $sep = ($count % 10) ? ", " : ",\n\t";
   }
 
   print($output "\n};\n\n");
@@ -226,7 +339,5 @@ sub process_file
   {
     close($output);
   }
-  
-  close(FILE);
 }
 
@@ -57,8 +57,17 @@ extern "C" {
 #endif
 
 /**
- * Number of bytes in receive buffer, must be at least the size of the longest incoming topic + 8
- * If one wants to avoid fragmented incoming publish, set length to max incoming topic length + max payload length + 8
+ * Number of publish payloads that can be queued by reference with mqtt_publish_ref(),
+ * 0 disables mqtt_publish_ref()
+ */
+#ifndef MQTT_OUTPUT_REF_MAX
+#define MQTT_OUTPUT_REF_MAX 0
+#endif
+
+/**
+ * Number of bytes in receive buffer, incoming topics split over received segments are copied here
+ * and must be shorter than this, longer topics need a topic callback (mqtt_set_inpub_topic_callback).
+ * Publish payload is passed to the application directly from received data.
  */
 #ifndef MQTT_VAR_HEADER_BUFFER_LEN
 #define MQTT_VAR_HEADER_BUFFER_LEN 128
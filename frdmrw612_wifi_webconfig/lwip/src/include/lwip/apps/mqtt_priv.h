@@ -59,10 +59,36 @@ struct mqtt_request_t
   u16_t timeout_diff;
 };
 
+#if MQTT_OUTPUT_REF_MAX > 0
+/** Publish payload sent by reference, see mqtt_publish_ref() */
+struct mqtt_output_ref_t {
+  /** Payload, referenced until TCP has acknowledged all of it */
+  struct pbuf *p;
+  /** Value of ring_in when the payload was queued, it goes out once ring_out reaches it */
+  u32_t ring_mark;
+  /** Output stream offset of the payload end, valid once written == p->tot_len */
+  u32_t stream_end;
+  /** Number of payload bytes handed to TCP */
+  u16_t written;
+};
+#endif /* MQTT_OUTPUT_REF_MAX > 0 */
+
 /** Ring buffer */
 struct mqtt_ringbuf_t {
   u16_t put;
   u16_t get;
+#if MQTT_OUTPUT_REF_MAX > 0
+  /** Number of bytes ever put into and taken out of the ring */
+  u32_t ring_in;
+  u32_t ring_out;
+  /** Number of bytes handed to TCP and acknowledged by it, ring and referenced payloads together */
+  u32_t stream_sent;
+  u32_t stream_acked;
+  /** Referenced payloads in output order, oldest at ref_head */
+  struct mqtt_output_ref_t refs[MQTT_OUTPUT_REF_MAX];
+  u8_t ref_head;
+  u8_t ref_cnt;
+#endif /* MQTT_OUTPUT_REF_MAX > 0 */
   u8_t buf[MQTT_OUTPUT_RINGBUF_SIZE];
 };
 
@@ -90,8 +116,21 @@ struct mqtt_client_s
   /** Incoming data callback */
   mqtt_incoming_data_cb_t data_cb;
   mqtt_incoming_publish_cb_t pub_cb;
-  /** Input */
-  u32_t msg_idx;
+  mqtt_incoming_topic_cb_t topic_cb;
+  /** Input parser state */
+  u8_t rx_state;
+  /** First byte of fixed header of message being received */
+  u8_t rx_type;
+  /** Number of remaining length bytes parsed */
+  u8_t rx_len_bytes;
+  /** Incoming publish is not passed to application, topic did not fit rx_buffer */
+  u8_t rx_skip;
+  /** Topic length of incoming publish */
+  u16_t rx_topic_len;
+  /** Number of bytes of current field received */
+  u16_t rx_idx;
+  /** Bytes of message not yet received */
+  u32_t rx_rem_len;
   u8_t rx_buffer[MQTT_VAR_HEADER_BUFFER_LEN];
   /** Output ring-buffer */
   struct mqtt_ringbuf_t output;
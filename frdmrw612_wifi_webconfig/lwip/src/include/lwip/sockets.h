@@ -148,6 +148,14 @@ struct msghdr {
 #define MSG_TRUNC   0x04
 #define MSG_CTRUNC  0x08
 
+#if LWIP_SOCKET_MMSG
+/* One entry of a recvmmsg()/sendmmsg() vector */
+struct mmsghdr {
+  struct msghdr msg_hdr;
+  unsigned int  msg_len; /* number of bytes transmitted for this entry */
+};
+#endif /* LWIP_SOCKET_MMSG */
+
 /* RFC 3542, Section 20: Ancillary Data */
 struct cmsghdr {
   socklen_t  cmsg_len;   /* number of bytes, including header */
@@ -273,6 +281,7 @@ struct linger {
 #define MSG_DONTWAIT   0x08    /* Nonblocking i/o for this operation only */
 #define MSG_MORE       0x10    /* Sender will send more */
 #define MSG_NOSIGNAL   0x20    /* Uninmplemented: Requests not to send the SIGPIPE signal if an attempt to send is made on a stream-oriented socket that is no longer connected. */
+#define MSG_NOCOPY     0x40    /* lwIP extension: TCP data is referenced instead of copied, it must stay unchanged until acknowledged by the peer (e.g. constant data in flash) */
 
 
 /*
@@ -572,6 +581,10 @@ void lwip_socket_thread_cleanup(void); /* LWIP_NETCONN_SEM_PER_THREAD==1: destro
 #define lwip_sendmsg      sendmsg
 #define lwip_sendto       sendto
 #define lwip_socket       socket
+#if LWIP_SOCKET_MMSG
+#define lwip_recvmmsg     recvmmsg
+#define lwip_sendmmsg     sendmmsg
+#endif
 #if LWIP_SOCKET_SELECT
 #define lwip_select       select
 #endif
@@ -620,6 +633,10 @@ ssize_t lwip_sendto(int s, const void *dataptr, size_t size, int flags,
 int lwip_socket(int domain, int type, int protocol);
 ssize_t lwip_write(int s, const void *dataptr, size_t size);
 ssize_t lwip_writev(int s, const struct iovec *iov, int iovcnt);
+#if LWIP_SOCKET_MMSG
+int lwip_recvmmsg(int s, struct mmsghdr *msgvec, unsigned int vlen, int flags);
+int lwip_sendmmsg(int s, struct mmsghdr *msgvec, unsigned int vlen, int flags);
+#endif
 #if LWIP_SOCKET_SELECT
 int lwip_select(int maxfdp1, fd_set *readset, fd_set *writeset, fd_set *exceptset,
                 struct timeval *timeout);
@@ -668,6 +685,12 @@ int lwip_inet_pton(int af, const char *src, void *dst);
 #define sendto(s,dataptr,size,flags,to,tolen)     lwip_sendto(s,dataptr,size,flags,to,tolen)
 /** @ingroup socket */
 #define socket(domain,type,protocol)              lwip_socket(domain,type,protocol)
+#if LWIP_SOCKET_MMSG
+/** @ingroup socket */
+#define recvmmsg(s,msgvec,vlen,flags)             lwip_recvmmsg(s,msgvec,vlen,flags)
+/** @ingroup socket */
+#define sendmmsg(s,msgvec,vlen,flags)             lwip_sendmmsg(s,msgvec,vlen,flags)
+#endif
 #if LWIP_SOCKET_SELECT
 /** @ingroup socket */
 #define select(maxfdp1,readset,writeset,exceptset,timeout)     lwip_select(maxfdp1,readset,writeset,exceptset,timeout)
@@ -98,6 +98,16 @@ struct sys_timeo {
 #if LWIP_DEBUG_TIMERNAMES
   const char* handler_name;
 #endif /* LWIP_DEBUG_TIMERNAMES */
+#if LWIP_TIMERS_WHEEL
+  /** the link pointing to this timeout (slot head or previous 'next') */
+  struct sys_timeo **pprev;
+  /** next timeout with the same hash of handler and arg */
+  struct sys_timeo *hash_next;
+  /** order of adding, for timeouts due at the same time */
+  u32_t seq;
+  /** wheel slot holding this timeout */
+  u16_t slot;
+#endif /* LWIP_TIMERS_WHEEL */
 };
 
 void sys_timeouts_init(void);
@@ -116,7 +126,9 @@ void sys_check_timeouts(void);
 u32_t sys_timeouts_sleeptime(void);
 
 #if LWIP_TESTMODE
+#if !LWIP_TIMERS_WHEEL
 struct sys_timeo** sys_timeouts_get_next_timeout(void);
+#endif /* !LWIP_TIMERS_WHEEL */
 void lwip_cyclic_timer(void *arg);
 #endif
 
@@ -85,6 +85,10 @@ struct udp_pcb {
 /* Protocol specific PCB members */
 
   struct udp_pcb *next;
+#if LWIP_UDP_PCB_HASH_SIZE
+  /** next pcb in the same bucket of the local port hash */
+  struct udp_pcb *hash_next;
+#endif
 
   u8_t flags;
   /** ports are in host byte order */
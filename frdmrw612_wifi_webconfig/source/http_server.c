@@ -13,7 +13,7 @@
 #include <string.h>
 
 /* FS data.*/
-extern const HTTPSRV_FS_DIR_ENTRY httpsrv_fs_data[];
+extern const HTTPSRV_FS_INDEX httpsrv_fs_index;
 extern const HTTPSRV_CGI_LINK_STRUCT cgi_lnk_tbl[];
 
 bool cgi_get_varval(char *src, char *var_name, char *dst, uint32_t length)
@@ -96,7 +96,7 @@ void http_srv_task(void *arg)
     uint32_t httpsrv_handle;
 
     /* Init Fs*/
-    HTTPSRV_FS_init(httpsrv_fs_data);
+    HTTPSRV_FS_init_index(&httpsrv_fs_index);
 
     /* Init HTTPSRV parameters.*/
     memset(&params, 0, sizeof(params));
@@ -7,6 +7,7 @@
 #include <httpsrv_fs.h>
 
 extern const HTTPSRV_FS_DIR_ENTRY httpsrv_fs_data[];
+extern const HTTPSRV_FS_INDEX httpsrv_fs_index;
 
 static const unsigned char httpsrv_fs_webui_favicon_ico[] = {
 	/* webui/favicon.ico */
@@ -127,6 +128,24 @@ static const unsigned char httpsrv_fs_webui_favicon_ico[] = {
 	0x45, 0x3b, 0x00, 0x00, 0x89, 0x0a, 0x00, 0x00, 0xae, 0x32
 };
 
+static const unsigned char httpsrv_fs_webui_favicon_ico_gz[] = {
+	/* webui/favicon.ico.gz */
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0x63, 0x60, 0x60, 0x04, 0x42, 0x01, 0x01, 0x06, 0x20, 0xa9,
+	0xc0, 0x90, 0xc1, 0xc2, 0xc0, 0x20, 0xc6, 0xc0, 0xc0, 0xa0,
+	0x01, 0xc4, 0x40, 0x21, 0xa0, 0x08, 0x44, 0x1c, 0x06, 0x84,
+	0xb9, 0x21, 0x18, 0x0e, 0xb6, 0xfe, 0xfc, 0x0f, 0xc3, 0xb7,
+	0x37, 0x56, 0x13, 0xc4, 0x0c, 0x97, 0x4e, 0xa2, 0xe2, 0x51,
+	0xfd, 0xa3, 0xfa, 0x47, 0xf5, 0x0f, 0x5d, 0xfd, 0x0c, 0x56,
+	0x0c, 0x10, 0xec, 0xf9, 0x91, 0x81, 0xe1, 0xe5, 0x6b, 0x06,
+	0x86, 0xdb, 0x36, 0x0c, 0x0c, 0x76, 0x33, 0x19, 0x18, 0x78,
+	0x65, 0x18, 0x18, 0xdc, 0xef, 0x31, 0x30, 0xf8, 0x9e, 0x60,
+	0x60, 0xe8, 0x5e, 0xc6, 0xc0, 0x10, 0x55, 0xcb, 0xc0, 0xa0,
+	0x2a, 0xcf, 0xc0, 0x70, 0xfa, 0x0f, 0x03, 0x83, 0xab, 0x35,
+	0x03, 0x43, 0x27, 0x17, 0x03, 0xc3, 0x3a, 0x23, 0x00, 0x13,
+	0x4b, 0x65, 0xb1, 0x7e, 0x04, 0x00, 0x00
+};
+
 static const unsigned char httpsrv_fs_webui_index_html[] = {
 	/* webui/index.html */
 	0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20,
@@ -925,6 +944,208 @@ static const unsigned char httpsrv_fs_webui_index_html[] = {
 	0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0d, 0x0a
 };
 
+static const unsigned char httpsrv_fs_webui_index_html_gz[] = {
+	/* webui/index.html.gz */
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xb5, 0x59, 0x5b, 0x8f, 0xe2, 0x36, 0x14, 0x7e, 0x6e, 0xa5,
+	0xfe, 0x07, 0x6f, 0xa4, 0x8a, 0x9d, 0x6a, 0x81, 0xbd, 0xa9,
+	0xaa, 0x66, 0x21, 0x15, 0x3b, 0xb3, 0x23, 0x4d, 0xd5, 0x4e,
+	0x51, 0x67, 0xaa, 0x76, 0x9f, 0x22, 0x93, 0x38, 0xc4, 0x3b,
+	0x8e, 0x1d, 0xd9, 0x0e, 0x0c, 0xff, 0xbe, 0xc7, 0x97, 0x84,
+	0x00, 0x09, 0x03, 0x0c, 0xcd, 0x0b, 0xc4, 0xf1, 0x39, 0x3e,
+	0xf7, 0xf3, 0x9d, 0x64, 0xf4, 0xea, 0xfa, 0xcf, 0xab, 0x87,
+	0xaf, 0xd3, 0x2f, 0x28, 0xd3, 0x39, 0x0b, 0x7f, 0xf8, 0x7e,
+	0x54, 0xff, 0x12, 0x9c, 0xc0, 0x2f, 0x82, 0x6b, 0xa4, 0xa9,
+	0x66, 0x24, 0xfc, 0x87, 0xf6, 0x6f, 0x28, 0x5a, 0x92, 0x19,
+	0x8a, 0x05, 0x4f, 0xe9, 0xbc, 0x94, 0x58, 0x53, 0xc1, 0x47,
+	0x43, 0xf7, 0xd8, 0xef, 0xcd, 0x89, 0xc6, 0x28, 0xce, 0xb0,
+	0x54, 0x44, 0x8f, 0x83, 0xbf, 0x1f, 0x6e, 0xfa, 0xbf, 0x04,
+	0x1b, 0xcf, 0x38, 0xce, 0xc9, 0x38, 0x58, 0x50, 0xb2, 0x2c,
+	0x84, 0xd4, 0x81, 0x61, 0xa6, 0x09, 0x87, 0xbd, 0x4b, 0x9a,
+	0xe8, 0x6c, 0x9c, 0x90, 0x05, 0x8d, 0x49, 0xdf, 0xde, 0xbc,
+	0x41, 0x94, 0x53, 0x4d, 0x31, 0xeb, 0xab, 0x18, 0x33, 0x32,
+	0x7e, 0x37, 0x78, 0x5b, 0xf3, 0x62, 0x94, 0x3f, 0x22, 0x49,
+	0xd8, 0x38, 0x50, 0x7a, 0xc5, 0x88, 0xca, 0x08, 0x01, 0x66,
+	0x99, 0x24, 0x29, 0x70, 0x22, 0x33, 0x27, 0xe2, 0x20, 0x56,
+	0xca, 0x50, 0x8c, 0x86, 0x5e, 0x1d, 0xf8, 0x3b, 0x13, 0xc9,
+	0x0a, 0x09, 0xce, 0x04, 0x4e, 0xc6, 0x41, 0x9c, 0x91, 0xf8,
+	0xf1, 0x36, 0xbd, 0xa1, 0x40, 0x27, 0x9e, 0x5e, 0x5f, 0x7c,
+	0xaa, 0xf9, 0x27, 0x74, 0x81, 0x28, 0xec, 0x28, 0xf0, 0x9c,
+	0x44, 0x39, 0xa6, 0x3c, 0xb0, 0xe4, 0xc8, 0x5f, 0x9b, 0xcf,
+	0x0d, 0x77, 0x22, 0x41, 0x17, 0x86, 0x95, 0x1a, 0x07, 0xee,
+	0x36, 0x9a, 0x61, 0xce, 0x61, 0x35, 0x5c, 0x53, 0xd5, 0x94,
+	0x9b, 0x1b, 0x8d, 0x09, 0xe0, 0x04, 0x22, 0x91, 0x14, 0xcb,
+	0xed, 0xfd, 0xdb, 0x34, 0x4c, 0xcc, 0x05, 0x18, 0x8d, 0xf5,
+	0x3f, 0xb6, 0xed, 0xb4, 0xbb, 0xb1, 0xb7, 0x43, 0xa6, 0x75,
+	0x71, 0x39, 0x1c, 0x2e, 0x97, 0xcb, 0x01, 0x7f, 0x2a, 0x06,
+	0xb1, 0xc8, 0x03, 0x64, 0x9d, 0x35, 0x0e, 0xee, 0xfe, 0x9d,
+	0x06, 0xe1, 0x88, 0xe6, 0x73, 0xa4, 0x64, 0x6c, 0x6f, 0x23,
+	0xc3, 0x78, 0x50, 0xf0, 0x79, 0x80, 0x30, 0xd3, 0x76, 0x09,
+	0xdd, 0x93, 0x9c, 0x82, 0x70, 0x49, 0x19, 0x6b, 0x01, 0xea,
+	0x39, 0x0f, 0x05, 0xef, 0xde, 0xbe, 0xfd, 0x11, 0x4c, 0x4d,
+	0xe8, 0x3c, 0x83, 0x7d, 0xb8, 0xd4, 0x02, 0x58, 0x0d, 0x71,
+	0x9b, 0xdc, 0x43, 0x10, 0xfc, 0x19, 0x7d, 0xbc, 0x0d, 0x34,
+	0x79, 0xd2, 0x56, 0x2d, 0x1b, 0x2e, 0xdf, 0x99, 0xab, 0x23,
+	0xe0, 0x0e, 0x3b, 0x66, 0x7b, 0xad, 0xba, 0xdf, 0x72, 0xa1,
+	0x17, 0xc2, 0x7a, 0xd1, 0x44, 0xc6, 0xa6, 0x97, 0xb7, 0xb7,
+	0x1d, 0xe0, 0x9e, 0xfd, 0x9e, 0x69, 0x6c, 0xcc, 0x09, 0x2f,
+	0xa3, 0x0e, 0x86, 0x3b, 0x51, 0x36, 0x13, 0x58, 0x26, 0x11,
+	0xe5, 0xa9, 0xd8, 0xb7, 0xdd, 0x92, 0xa8, 0x02, 0xf3, 0x35,
+	0xcd, 0x1d, 0x64, 0x5b, 0x10, 0x7e, 0x36, 0x7f, 0x47, 0x43,
+	0xf3, 0x28, 0x1c, 0xcd, 0xe4, 0x71, 0x2c, 0x6e, 0x21, 0x52,
+	0x6e, 0xa7, 0x07, 0x51, 0x77, 0xf9, 0xbb, 0x43, 0x1f, 0xa5,
+	0xb1, 0x2e, 0xd5, 0xb3, 0x1a, 0xed, 0xe7, 0x89, 0xae, 0x4a,
+	0x29, 0xa1, 0x80, 0x20, 0x17, 0x2e, 0x7f, 0x88, 0x84, 0x5c,
+	0x3e, 0xc3, 0xf0, 0x19, 0x29, 0xb7, 0x3d, 0xe5, 0xc4, 0xbc,
+	0xe5, 0x09, 0x8d, 0xb1, 0xcd, 0x03, 0xa3, 0x81, 0x5b, 0x9c,
+	0x80, 0x6d, 0x26, 0xd3, 0x33, 0x32, 0xbc, 0xfa, 0xfd, 0x36,
+	0x08, 0xaf, 0x18, 0x05, 0x85, 0x9e, 0x35, 0xe6, 0x4e, 0x44,
+	0x1f, 0xaa, 0xe4, 0xd1, 0x61, 0x38, 0x2b, 0xb5, 0x16, 0x1c,
+	0xe9, 0x55, 0x01, 0xa5, 0xc3, 0xdd, 0x04, 0xbe, 0x90, 0x9b,
+	0xd2, 0x18, 0xcd, 0x82, 0x0d, 0x76, 0xd5, 0x0e, 0xab, 0x56,
+	0x8c, 0x79, 0xbd, 0x20, 0x78, 0xcc, 0x68, 0xfc, 0xe8, 0x56,
+	0x5f, 0x5f, 0x04, 0xe1, 0x3d, 0xfc, 0x1a, 0xc7, 0xa5, 0x14,
+	0xdd, 0x11, 0xbd, 0x14, 0xf2, 0x51, 0x8d, 0x86, 0x6e, 0xf7,
+	0x5e, 0x79, 0xe4, 0xff, 0x20, 0x6d, 0x2d, 0x9c, 0x28, 0x08,
+	0x8f, 0x62, 0x46, 0x30, 0x94, 0x70, 0x1b, 0xa7, 0x09, 0xb4,
+	0x20, 0x31, 0x2f, 0x89, 0x91, 0xf8, 0xca, 0xac, 0x23, 0x9b,
+	0x50, 0x08, 0x5a, 0x9c, 0xa6, 0x7c, 0xfe, 0x9c, 0xc8, 0x9d,
+	0x55, 0xb0, 0xd3, 0x81, 0xeb, 0xee, 0x12, 0xf9, 0xf6, 0x18,
+	0x6c, 0x54, 0x2a, 0xbf, 0xb8, 0xae, 0x97, 0x9d, 0x51, 0xe0,
+	0x19, 0xf5, 0x14, 0x89, 0x4d, 0xed, 0x8c, 0xb8, 0xb7, 0x72,
+	0xaf, 0x33, 0x70, 0x2c, 0x59, 0xf6, 0x21, 0x44, 0x93, 0x05,
+	0xa6, 0x0c, 0xcf, 0x18, 0xf1, 0x99, 0x55, 0x39, 0x08, 0xf5,
+	0xd1, 0x95, 0x31, 0x14, 0xd2, 0x02, 0xfd, 0x26, 0x28, 0xbf,
+	0x84, 0xee, 0xfa, 0x61, 0x9f, 0x3f, 0x28, 0x2f, 0x4a, 0xed,
+	0xdd, 0x61, 0x1b, 0xee, 0x4c, 0x3c, 0xb9, 0xe0, 0xc0, 0x8c,
+	0x19, 0x89, 0x54, 0xe5, 0x1e, 0xdb, 0xe6, 0x55, 0xc3, 0x15,
+	0x90, 0xd8, 0xd0, 0x1c, 0xae, 0xcb, 0x82, 0x99, 0x54, 0x21,
+	0xaa, 0xd1, 0xa1, 0x5b, 0x8f, 0x02, 0x79, 0x09, 0x43, 0xa9,
+	0x90, 0x0d, 0xde, 0xe1, 0x7d, 0x26, 0x96, 0x68, 0xc2, 0x18,
+	0xe2, 0x75, 0x88, 0xd9, 0x7d, 0x87, 0x14, 0xaa, 0x25, 0x4d,
+	0x69, 0xc4, 0xa8, 0xd2, 0x87, 0x54, 0x29, 0x6b, 0x69, 0xa0,
+	0x88, 0xb8, 0x68, 0x18, 0xfa, 0x4e, 0xac, 0x4d, 0xe7, 0x6d,
+	0x4a, 0xd8, 0x79, 0x92, 0xbb, 0xe3, 0x69, 0xf6, 0x31, 0xbc,
+	0x26, 0x2a, 0x96, 0xb4, 0x70, 0x00, 0xad, 0xd3, 0x3d, 0xa3,
+	0xa2, 0x5b, 0x84, 0xcf, 0x2b, 0x94, 0x90, 0x14, 0x97, 0x4c,
+	0xbf, 0x41, 0x3a, 0x23, 0xc8, 0xa6, 0x02, 0x8a, 0x25, 0x31,
+	0x7e, 0x40, 0x90, 0xb6, 0x93, 0x38, 0x26, 0x4a, 0xa1, 0x29,
+	0x84, 0x80, 0x86, 0x7b, 0x48, 0x07, 0x8d, 0xa5, 0x86, 0x47,
+	0x90, 0x17, 0x72, 0x01, 0x60, 0x66, 0x99, 0xd1, 0x38, 0x43,
+	0x85, 0x14, 0x0b, 0x9a, 0x00, 0x89, 0xce, 0xa8, 0xb2, 0xdd,
+	0x1c, 0xf6, 0x13, 0x99, 0xe2, 0x98, 0x0c, 0xba, 0xb4, 0x2b,
+	0x4e, 0x90, 0x17, 0x3d, 0x18, 0xfe, 0x35, 0x6f, 0xa4, 0xc0,
+	0xeb, 0x0a, 0xad, 0x44, 0x09, 0x6e, 0xc7, 0x72, 0xb6, 0x42,
+	0x78, 0x2b, 0x9e, 0x2b, 0x0f, 0x0d, 0x5c, 0x38, 0x43, 0x22,
+	0x23, 0x53, 0x35, 0x40, 0x55, 0xc1, 0x89, 0x25, 0x5c, 0x8a,
+	0x92, 0x25, 0x88, 0xd1, 0x47, 0x62, 0x62, 0x1d, 0x92, 0x8e,
+	0x43, 0x16, 0x99, 0xbf, 0x10, 0x5b, 0x15, 0x73, 0xb8, 0x23,
+	0xe6, 0x4c, 0x4b, 0x08, 0xd6, 0x49, 0xe0, 0x0e, 0xca, 0x05,
+	0x70, 0x7d, 0xa8, 0x8d, 0xb6, 0xa4, 0x10, 0x7c, 0xf0, 0x9c,
+	0x23, 0xb5, 0xa4, 0x1a, 0x6c, 0x62, 0xb8, 0xd9, 0x1a, 0x8f,
+	0x72, 0x68, 0x57, 0xd6, 0x78, 0x58, 0x6b, 0x92, 0x17, 0x7a,
+	0xeb, 0x20, 0xaa, 0xcf, 0x6b, 0xa3, 0xdb, 0xb4, 0xe2, 0x0e,
+	0x81, 0x81, 0xc0, 0x5e, 0xaa, 0xb4, 0x5e, 0x4c, 0x4b, 0xf6,
+	0x66, 0x5b, 0x03, 0x84, 0x25, 0x58, 0x11, 0xfa, 0x13, 0x49,
+	0xc0, 0xac, 0x5e, 0x95, 0x14, 0xaa, 0x50, 0x86, 0x72, 0x92,
+	0x0b, 0xb9, 0x42, 0x4a, 0x00, 0x0d, 0xd6, 0x60, 0x49, 0xc0,
+	0x6e, 0x9a, 0xe6, 0xa4, 0x11, 0x28, 0x3e, 0x18, 0xca, 0x02,
+	0x40, 0xbc, 0xae, 0x0e, 0x55, 0x28, 0x01, 0xa4, 0x1d, 0x6b,
+	0xb6, 0x32, 0xca, 0xd9, 0xf3, 0x3c, 0xb2, 0x83, 0x33, 0x36,
+	0xbc, 0x72, 0x94, 0xda, 0x2f, 0xc7, 0x7f, 0xa9, 0x10, 0xba,
+	0x1d, 0x7e, 0xef, 0xc0, 0x60, 0xd5, 0xc6, 0x13, 0xe6, 0x8a,
+	0x57, 0xfd, 0x3e, 0xfa, 0x6c, 0x11, 0x3f, 0x54, 0xc8, 0x03,
+	0xae, 0xd0, 0xd1, 0xfc, 0x74, 0xf8, 0xf5, 0x22, 0x9a, 0xa3,
+	0xae, 0xa6, 0x4e, 0xb6, 0x45, 0x9b, 0x69, 0xc9, 0x24, 0x88,
+	0x1b, 0x69, 0x90, 0xdd, 0xb1, 0x53, 0x2b, 0xcd, 0x26, 0x40,
+	0xf2, 0xa6, 0x43, 0xd5, 0xed, 0xca, 0x11, 0xc0, 0x28, 0x14,
+	0x3f, 0xce, 0xa5, 0x28, 0x79, 0x12, 0x20, 0x3b, 0xaf, 0x8d,
+	0x83, 0x84, 0xaa, 0x82, 0xe1, 0xd5, 0x25, 0x87, 0x6c, 0xdb,
+	0x29, 0xea, 0xa3, 0xec, 0x7d, 0x68, 0x4f, 0xe6, 0x70, 0xea,
+	0x00, 0x2e, 0x28, 0x62, 0xef, 0xf7, 0x0c, 0x52, 0xee, 0xe8,
+	0xe0, 0xe0, 0x18, 0x68, 0x1d, 0xe5, 0x70, 0x01, 0xb2, 0x2b,
+	0x05, 0xe1, 0x97, 0x9c, 0xa6, 0x44, 0xdd, 0xb7, 0x7a, 0x31,
+	0x13, 0x8a, 0x5c, 0x57, 0xb0, 0x61, 0x97, 0xf3, 0xc5, 0xa7,
+	0x5e, 0x9b, 0x36, 0x6d, 0x52, 0xd4, 0xe8, 0x63, 0x5b, 0x9c,
+	0x7a, 0xbd, 0x2d, 0x23, 0xc0, 0x5a, 0x5f, 0x6c, 0x59, 0xba,
+	0x5a, 0x27, 0xb4, 0xb7, 0x61, 0x3b, 0xdc, 0xe8, 0xaa, 0x26,
+	0xeb, 0x8e, 0x5a, 0x08, 0xa5, 0x23, 0xa5, 0x68, 0x12, 0xde,
+	0xdf, 0xdf, 0x5e, 0x5f, 0xee, 0x6f, 0xa2, 0xbe, 0xe9, 0x5b,
+	0x0c, 0x53, 0xd1, 0x05, 0x68, 0x81, 0x59, 0x09, 0x56, 0x33,
+	0xf4, 0x81, 0x07, 0x04, 0x66, 0xee, 0xab, 0xda, 0x7f, 0x63,
+	0x27, 0xb4, 0x99, 0x04, 0x86, 0xf4, 0xd5, 0x91, 0x43, 0xe5,
+	0xa1, 0x5a, 0x90, 0xb8, 0x94, 0x54, 0xaf, 0xc2, 0x7b, 0xff,
+	0xe7, 0x58, 0x6d, 0x3c, 0x59, 0xad, 0xd1, 0x7a, 0xa1, 0x4b,
+	0xab, 0x7a, 0xc3, 0x89, 0x9a, 0xf9, 0x97, 0x0d, 0x3e, 0x30,
+	0xac, 0x3c, 0x51, 0x4a, 0x09, 0x4b, 0x82, 0x03, 0x75, 0x36,
+	0xb4, 0x45, 0x26, 0xb1, 0x22, 0xe1, 0xd4, 0xb3, 0x39, 0x52,
+	0xeb, 0xea, 0xf4, 0x5a, 0xeb, 0x69, 0xbd, 0xe0, 0xb4, 0x5e,
+	0x6f, 0x68, 0x68, 0xbe, 0x3e, 0x37, 0x40, 0x39, 0x7e, 0x62,
+	0x84, 0xcf, 0xcd, 0x4b, 0x84, 0x9f, 0x3f, 0x74, 0x0a, 0x6e,
+	0x07, 0xcd, 0xbd, 0x22, 0x6d, 0x63, 0xc9, 0xf5, 0x5c, 0x01,
+	0x4d, 0xbf, 0x92, 0xca, 0xce, 0x17, 0x06, 0xfa, 0x55, 0x0b,
+	0x5d, 0x2d, 0xa5, 0xe3, 0xbc, 0x4e, 0x6f, 0xd4, 0xe3, 0xb1,
+	0xd5, 0x8f, 0x48, 0x09, 0x4d, 0xc1, 0xbc, 0x01, 0xd9, 0x37,
+	0x20, 0x57, 0x43, 0x89, 0xb7, 0x5c, 0x43, 0x64, 0x58, 0xa1,
+	0x09, 0x60, 0xaa, 0x1b, 0x21, 0x73, 0x3b, 0x60, 0xb8, 0x56,
+	0xd9, 0x31, 0x53, 0x1c, 0xd8, 0xd6, 0x8c, 0x74, 0x6e, 0x82,
+	0xb1, 0x0d, 0x56, 0xe6, 0xa7, 0xd7, 0xb2, 0x60, 0xb3, 0x96,
+	0xf5, 0x36, 0xd8, 0xf6, 0x2e, 0x3e, 0xb5, 0x40, 0xf2, 0x76,
+	0x11, 0x4e, 0x2e, 0x64, 0x76, 0xe4, 0x32, 0xdd, 0xa7, 0x9a,
+	0xb7, 0xa0, 0x1f, 0xa0, 0x89, 0x74, 0x18, 0x4d, 0x01, 0x76,
+	0xf8, 0xb5, 0xa5, 0x3b, 0x78, 0x28, 0x64, 0x41, 0xa1, 0xc5,
+	0x5f, 0x56, 0x16, 0x8b, 0x39, 0x14, 0x5e, 0xd4, 0x70, 0xa3,
+	0x89, 0x77, 0x52, 0x29, 0xf2, 0x06, 0x82, 0x71, 0x50, 0xc7,
+	0x60, 0x33, 0x49, 0xe0, 0xe4, 0xc6, 0x13, 0x63, 0x3c, 0x03,
+	0x60, 0x26, 0x53, 0x8b, 0xdf, 0x06, 0xe8, 0xab, 0x01, 0x8b,
+	0xe6, 0x90, 0x0c, 0x58, 0x9b, 0x27, 0x39, 0xe6, 0x25, 0x80,
+	0xc4, 0x15, 0x90, 0x36, 0xd0, 0xdc, 0x9a, 0x03, 0x76, 0xd8,
+	0xb9, 0x30, 0xd8, 0x79, 0xe0, 0x40, 0x4d, 0x8b, 0xf8, 0x3e,
+	0x66, 0x76, 0x87, 0x55, 0xb4, 0xc4, 0xd2, 0x74, 0xc6, 0x2a,
+	0xf1, 0x54, 0x39, 0xcb, 0xa9, 0x0e, 0x5a, 0xa2, 0xab, 0xe1,
+	0x81, 0x79, 0x3d, 0xbe, 0xee, 0x99, 0x57, 0xbb, 0xcf, 0x3c,
+	0xe4, 0xac, 0x7d, 0x81, 0x02, 0x67, 0x63, 0x1e, 0x9b, 0xc9,
+	0xa7, 0x3e, 0xfc, 0x45, 0xdd, 0xda, 0x58, 0x3e, 0x72, 0x78,
+	0x3a, 0xf2, 0xed, 0xff, 0xa5, 0xa0, 0xa3, 0x8d, 0xf5, 0xa9,
+	0x41, 0x3b, 0x71, 0x78, 0xde, 0x84, 0x6d, 0x03, 0x71, 0x43,
+	0x10, 0xac, 0xcb, 0x47, 0xf3, 0x18, 0x0f, 0x7b, 0x23, 0x6e,
+	0xdf, 0xd7, 0xf9, 0x5a, 0x52, 0xcd, 0x8d, 0xdd, 0xe1, 0x5d,
+	0x07, 0xde, 0x1c, 0x02, 0x14, 0x94, 0xf3, 0x47, 0x41, 0x78,
+	0xd7, 0xc1, 0x1c, 0x6f, 0xbc, 0x1e, 0x73, 0x43, 0x5b, 0xdf,
+	0x06, 0x9e, 0x19, 0xd0, 0xd8, 0x06, 0x66, 0xb7, 0xb2, 0x98,
+	0xe9, 0xce, 0x4c, 0x71, 0x7e, 0x42, 0x01, 0x91, 0x21, 0xcf,
+	0x24, 0x24, 0x1f, 0x73, 0x9c, 0x2b, 0x84, 0xde, 0x31, 0x82,
+	0x80, 0x54, 0x53, 0xf0, 0xbc, 0x22, 0xf5, 0x1c, 0x63, 0xc9,
+	0xdd, 0x7b, 0x7d, 0x97, 0x05, 0x76, 0x64, 0xb0, 0x4c, 0xfc,
+	0xb8, 0x03, 0x66, 0x2a, 0x49, 0x77, 0x1e, 0x3c, 0x0b, 0xf4,
+	0xba, 0x67, 0xe2, 0x7d, 0x41, 0xb5, 0xe3, 0x77, 0x5b, 0xca,
+	0xab, 0xd7, 0xf6, 0x67, 0x2b, 0x98, 0x4d, 0xae, 0xbd, 0x3d,
+	0xc5, 0xb2, 0xb9, 0xef, 0xd4, 0xb0, 0x6b, 0x30, 0xb2, 0x2f,
+	0xfa, 0x83, 0x70, 0xc2, 0xd1, 0x17, 0x73, 0x0f, 0xa5, 0x49,
+	0x21, 0x11, 0xdb, 0x68, 0x48, 0x3a, 0x03, 0xaa, 0x41, 0x9f,
+	0xab, 0x79, 0x10, 0xa2, 0x36, 0x9f, 0x1c, 0xd1, 0x83, 0xfc,
+	0x78, 0x79, 0x76, 0x9b, 0x6e, 0xf2, 0xdd, 0x67, 0xd5, 0xcd,
+	0x9d, 0x2f, 0xb2, 0x6b, 0xc5, 0xca, 0x5b, 0xf6, 0xde, 0xdd,
+	0xbe, 0xda, 0x6f, 0xcc, 0x8a, 0xe8, 0x2c, 0xe6, 0x74, 0x29,
+	0x69, 0x5e, 0xba, 0x9d, 0xdd, 0xa2, 0x3b, 0xac, 0x7b, 0x7b,
+	0xfb, 0xfa, 0xd6, 0xe6, 0x93, 0xcb, 0xe4, 0x0d, 0x95, 0x4a,
+	0xfb, 0x06, 0xbb, 0xd5, 0x56, 0xbb, 0xab, 0x9e, 0xed, 0xb7,
+	0xe6, 0xed, 0x84, 0xaf, 0x6d, 0xd0, 0x67, 0x29, 0x47, 0x57,
+	0xeb, 0x37, 0x2a, 0x03, 0xe4, 0x4a, 0xd0, 0x1b, 0x94, 0x36,
+	0xf8, 0x77, 0x36, 0x70, 0xdb, 0xe4, 0xb5, 0x5c, 0x21, 0x3c,
+	0xc7, 0x94, 0x77, 0x14, 0x36, 0x38, 0xf7, 0x4e, 0x68, 0xe2,
+	0xca, 0x97, 0xae, 0x61, 0x05, 0x00, 0x07, 0xb1, 0x83, 0x2d,
+	0xcc, 0x80, 0xd3, 0xc5, 0xe6, 0xa4, 0xb7, 0xd3, 0xeb, 0x86,
+	0xdf, 0xd1, 0xd9, 0xc1, 0x57, 0x7f, 0x39, 0x25, 0x1b, 0xf6,
+	0xf3, 0x8d, 0x16, 0x50, 0x3e, 0x3d, 0x9b, 0x24, 0xc7, 0x46,
+	0xd0, 0x56, 0xd3, 0xf7, 0xb2, 0x1c, 0x96, 0x01, 0xbb, 0xd9,
+	0x30, 0x72, 0x6f, 0x35, 0x1b, 0x53, 0xd6, 0xf0, 0x1b, 0x5e,
+	0x60, 0xb7, 0x1a, 0xb8, 0x6f, 0x99, 0xeb, 0xaf, 0xbf, 0xdf,
+	0x1c, 0x2c, 0xb7, 0x0f, 0xdd, 0xc7, 0xdf, 0xa1, 0xf9, 0xc6,
+	0xe7, 0x3e, 0x08, 0xbb, 0xef, 0xdc, 0xff, 0x01, 0x65, 0x69,
+	0x0c, 0xf9, 0x01, 0x1f, 0x00, 0x00
+};
+
 static const unsigned char httpsrv_fs_webui_NXP_logo_png[] = {
 	/* webui/NXP_logo.png */
 	0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00,
@@ -1948,6 +2169,219 @@ static const unsigned char httpsrv_fs_webui_webconfig_css[] = {
 	0x33, 0x30, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x7d
 };
 
+static const unsigned char httpsrv_fs_webui_webconfig_css_gz[] = {
+	/* webui/webconfig.css.gz */
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xcd, 0x59, 0xdb, 0x6e, 0xe3, 0xb8, 0x19, 0xbe, 0x4e, 0x80,
+	0xbc, 0x03, 0x31, 0x46, 0x80, 0x24, 0xb0, 0x35, 0xa2, 0x6c,
+	0xf9, 0x88, 0x02, 0x3b, 0xc8, 0x6e, 0x76, 0xdb, 0x8b, 0xbd,
+	0xe8, 0x45, 0x6f, 0x8a, 0xc2, 0xa0, 0x25, 0xca, 0x66, 0x23,
+	0x8b, 0x06, 0x29, 0x8f, 0x93, 0x31, 0xf2, 0xee, 0xe5, 0x59,
+	0xa4, 0x2c, 0x3b, 0xee, 0xb6, 0x05, 0x1a, 0xc1, 0x81, 0x25,
+	0x52, 0xff, 0xf9, 0xf0, 0xfd, 0xf4, 0x13, 0x38, 0xde, 0xdd,
+	0x02, 0xb0, 0xa2, 0x6f, 0x03, 0x4e, 0x7e, 0x90, 0x6a, 0x3d,
+	0x17, 0xdf, 0x59, 0x8e, 0xd9, 0x40, 0x3c, 0x5a, 0xdc, 0xdd,
+	0x7e, 0xdc, 0xdd, 0xde, 0xdd, 0xae, 0x68, 0xfe, 0x2e, 0xf7,
+	0xdd, 0xac, 0x50, 0xf6, 0xba, 0x66, 0x74, 0x5f, 0xe5, 0x83,
+	0x8c, 0x96, 0x94, 0xcd, 0x41, 0xef, 0xe5, 0xe5, 0x45, 0x6c,
+	0xbb, 0x29, 0x68, 0x55, 0x0f, 0x0a, 0xb4, 0x25, 0xe5, 0xfb,
+	0x1c, 0xfc, 0x0d, 0xb3, 0x1c, 0x55, 0x08, 0xfc, 0x8e, 0xf7,
+	0xb8, 0x0f, 0x7e, 0xc3, 0xe5, 0x77, 0x5c, 0x93, 0x0c, 0xf5,
+	0xc1, 0x37, 0x46, 0x50, 0xd9, 0x07, 0x1c, 0x55, 0x7c, 0xc0,
+	0x31, 0x23, 0x85, 0x7b, 0xf5, 0x80, 0xc9, 0x7a, 0x53, 0xcf,
+	0x41, 0x45, 0xd9, 0x16, 0x95, 0xf2, 0xb1, 0x65, 0x30, 0x1e,
+	0x8f, 0xe5, 0xed, 0x16, 0xb1, 0x35, 0xa9, 0xe6, 0x20, 0xde,
+	0x39, 0xb1, 0x36, 0x50, 0x09, 0x55, 0x92, 0x0a, 0x0f, 0x36,
+	0xe6, 0xfd, 0x64, 0xaa, 0xd6, 0x5b, 0xdb, 0x6f, 0x76, 0x28,
+	0xcf, 0x95, 0x72, 0xe6, 0xbe, 0xc6, 0x6f, 0xf5, 0x80, 0x54,
+	0x39, 0xae, 0x6a, 0xf7, 0xcc, 0x32, 0xfc, 0x65, 0x3c, 0xfe,
+	0x16, 0x4f, 0x1d, 0x93, 0x44, 0x31, 0x71, 0x8b, 0xdf, 0xa6,
+	0x71, 0xf2, 0xdc, 0x70, 0x18, 0xd4, 0x74, 0x17, 0x08, 0xb5,
+	0xbb, 0xbb, 0x3d, 0x5a, 0x06, 0xa8, 0x24, 0x6b, 0x21, 0xc3,
+	0x3f, 0xf7, 0xbc, 0x26, 0xc5, 0xbb, 0xdd, 0xf1, 0xf5, 0x09,
+	0xbc, 0x50, 0x06, 0xb6, 0x74, 0x45, 0x4a, 0x0c, 0x76, 0x1b,
+	0x5a, 0x61, 0x3e, 0x07, 0x4f, 0x5f, 0xef, 0x6e, 0xff, 0x9e,
+	0x95, 0x88, 0xf3, 0xa7, 0x3f, 0x7d, 0x11, 0xdc, 0x06, 0x5f,
+	0xfe, 0xa1, 0x5d, 0x73, 0x20, 0x79, 0xbd, 0x99, 0x03, 0x18,
+	0xc7, 0xf7, 0x96, 0xc2, 0x4f, 0x5b, 0x9c, 0x13, 0x04, 0x68,
+	0x55, 0xbe, 0x03, 0x9e, 0x31, 0x8c, 0x2b, 0x80, 0xaa, 0x1c,
+	0x3c, 0x6c, 0x85, 0x3c, 0x66, 0xfb, 0x64, 0x2c, 0x0c, 0xf1,
+	0xa8, 0x29, 0x18, 0x86, 0x39, 0xe6, 0xaf, 0x4a, 0x5a, 0xc9,
+	0x0a, 0x80, 0x48, 0x32, 0x11, 0x16, 0x34, 0x2f, 0x4c, 0xa3,
+	0xe1, 0xf0, 0x7e, 0xf1, 0xe1, 0x56, 0x12, 0xb7, 0x02, 0xc7,
+	0xd1, 0x78, 0xec, 0x2f, 0x0d, 0xdd, 0x52, 0x92, 0xfa, 0xcf,
+	0x47, 0xee, 0xf9, 0x70, 0xd8, 0xa2, 0x96, 0xba, 0xa5, 0x11,
+	0x6c, 0x51, 0x1b, 0xbb, 0xa5, 0x34, 0xf6, 0x9f, 0x4f, 0x9a,
+	0xe7, 0x6d, 0xd9, 0xa6, 0x6e, 0x69, 0xdc, 0x96, 0x6d, 0xe6,
+	0x96, 0x26, 0x81, 0x6c, 0x30, 0x6e, 0x34, 0x6d, 0x0b, 0x07,
+	0x1b, 0x2b, 0xcc, 0xda, 0xd2, 0x41, 0xcf, 0x0e, 0xb1, 0x96,
+	0x4f, 0xb9, 0xa0, 0xd3, 0x55, 0x45, 0x49, 0x91, 0x88, 0xa7,
+	0x12, 0x17, 0xf5, 0x42, 0xde, 0xbb, 0xa8, 0x83, 0xa9, 0x0a,
+	0x10, 0xe9, 0x0a, 0x9d, 0x5d, 0xe2, 0xd1, 0xee, 0x0d, 0x70,
+	0x5a, 0x92, 0x1c, 0x30, 0x9c, 0x2f, 0xa4, 0x4b, 0x14, 0xdd,
+	0xbb, 0xdb, 0x88, 0xd1, 0xc3, 0x7c, 0x8e, 0x8a, 0x1a, 0x33,
+	0x4d, 0x35, 0x13, 0xf9, 0xa1, 0xe2, 0xf4, 0xcb, 0x17, 0x45,
+	0x23, 0x2b, 0x31, 0x62, 0x32, 0x4d, 0xeb, 0x8d, 0xba, 0xcf,
+	0x09, 0xdf, 0x95, 0x48, 0xa4, 0x5d, 0x8d, 0x56, 0x25, 0x5e,
+	0x38, 0x42, 0x82, 0xd4, 0x16, 0x57, 0xfb, 0xe5, 0x6a, 0x5f,
+	0xd7, 0xb4, 0xea, 0x83, 0x1e, 0xda, 0x2d, 0x77, 0x42, 0xe8,
+	0x83, 0x90, 0x40, 0x7c, 0x59, 0x63, 0xa0, 0x57, 0xbc, 0x80,
+	0xcd, 0x71, 0x46, 0x19, 0xaa, 0x09, 0xad, 0x64, 0x26, 0x56,
+	0xd8, 0xa5, 0xa7, 0xa8, 0x0d, 0x58, 0x46, 0x42, 0x90, 0x29,
+	0x6c, 0xbd, 0x7a, 0x88, 0xfb, 0xe2, 0x7a, 0x74, 0x29, 0xc5,
+	0x37, 0x28, 0x17, 0xe2, 0xcb, 0x84, 0x50, 0x1a, 0xca, 0x8f,
+	0xd8, 0x86, 0x1e, 0x92, 0x34, 0xed, 0xdb, 0x4f, 0x1c, 0x0d,
+	0x1f, 0xfb, 0x40, 0xbc, 0x02, 0xfc, 0x3f, 0xf9, 0x8a, 0xfd,
+	0xa8, 0x57, 0x14, 0x69, 0xb1, 0x79, 0xa2, 0xc8, 0x9b, 0xaa,
+	0xc4, 0x50, 0x4e, 0xf6, 0x22, 0x5d, 0x12, 0x2d, 0x89, 0x79,
+	0xca, 0xeb, 0xf7, 0x12, 0x37, 0x22, 0xab, 0x6a, 0x66, 0x24,
+	0x19, 0x0a, 0x72, 0xf2, 0x03, 0x25, 0xdd, 0xde, 0x54, 0xfd,
+	0x35, 0xe9, 0x0b, 0x84, 0x52, 0xf7, 0x41, 0x81, 0x18, 0x6a,
+	0xc2, 0x36, 0x1e, 0x12, 0xb5, 0x2a, 0x13, 0xcb, 0x56, 0x98,
+	0x89, 0x29, 0x17, 0x4d, 0x2d, 0xd4, 0x96, 0x48, 0x46, 0xb3,
+	0x3e, 0x80, 0x53, 0xd8, 0x07, 0xc6, 0x1e, 0x4c, 0x54, 0x39,
+	0xa2, 0x6d, 0xa9, 0x0c, 0x06, 0xe2, 0x08, 0xf2, 0x3e, 0x68,
+	0xde, 0x53, 0x0f, 0x94, 0x3d, 0xf7, 0x8c, 0x4b, 0x83, 0xee,
+	0x28, 0x11, 0xae, 0x66, 0x8d, 0x62, 0x5a, 0x7c, 0x13, 0x26,
+	0x82, 0x07, 0x9c, 0x4d, 0x04, 0x8f, 0xd1, 0x54, 0xfc, 0x53,
+	0x56, 0xf9, 0x68, 0x7b, 0x79, 0xbe, 0xa1, 0xdf, 0x31, 0x3b,
+	0xef, 0x6b, 0xbd, 0xfe, 0x89, 0xc7, 0x1b, 0xf7, 0x0a, 0xbf,
+	0x09, 0x66, 0xf6, 0x13, 0x47, 0xb3, 0x2b, 0x3c, 0x6d, 0xdd,
+	0x76, 0x95, 0x8f, 0xfd, 0xb0, 0x80, 0x8a, 0xf8, 0x0f, 0x55,
+	0x96, 0xdf, 0x64, 0x35, 0xe8, 0xb4, 0x32, 0x94, 0x16, 0x18,
+	0xa7, 0x7d, 0x90, 0x34, 0x16, 0x50, 0x35, 0xf5, 0x57, 0x55,
+	0x07, 0xb5, 0x9a, 0xaa, 0xc4, 0xf5, 0x78, 0x86, 0xaa, 0x4f,
+	0xa3, 0xff, 0xd8, 0xc5, 0x24, 0x16, 0x5e, 0x4c, 0x60, 0x6c,
+	0x5d, 0x79, 0xea, 0x0c, 0xd1, 0x95, 0xa6, 0xa8, 0x69, 0x12,
+	0x3e, 0xab, 0xeb, 0x5c, 0x00, 0xba, 0xf8, 0x42, 0x28, 0xf4,
+	0x82, 0x69, 0xd2, 0x07, 0x29, 0x0c, 0x95, 0xfb, 0x2b, 0xce,
+	0x03, 0xd5, 0x54, 0x0d, 0x58, 0x8a, 0xca, 0x50, 0x10, 0xb6,
+	0x35, 0x2b, 0xd1, 0x01, 0xb1, 0x4a, 0xc4, 0xb0, 0x60, 0x9d,
+	0x95, 0x44, 0x54, 0x8c, 0xbf, 0x88, 0x70, 0x5a, 0xae, 0x50,
+	0x55, 0x09, 0x76, 0xe1, 0x96, 0x13, 0xee, 0xbd, 0x7c, 0x92,
+	0x64, 0x49, 0x76, 0x46, 0xd9, 0x19, 0x86, 0x09, 0x4c, 0xb4,
+	0x40, 0x17, 0x59, 0x3b, 0xdd, 0x3f, 0x13, 0xe0, 0x8c, 0x11,
+	0x7a, 0xab, 0x21, 0x1c, 0xc1, 0x51, 0x67, 0x64, 0x17, 0x34,
+	0xdb, 0xf3, 0x0b, 0x66, 0x55, 0xeb, 0x3a, 0xb2, 0xe9, 0xbe,
+	0x96, 0xa0, 0x40, 0x04, 0xa7, 0xa3, 0xb4, 0xc1, 0x48, 0x68,
+	0x65, 0x84, 0xd1, 0xbb, 0x5a, 0x85, 0x22, 0x36, 0x85, 0x62,
+	0x1a, 0xd6, 0x09, 0x29, 0xa7, 0xa8, 0xeb, 0x87, 0x39, 0xda,
+	0xd7, 0xb4, 0x2b, 0x22, 0x5d, 0x05, 0x0c, 0x18, 0xc9, 0xa2,
+	0x8d, 0x88, 0xe3, 0x65, 0xe0, 0x88, 0xa5, 0xb1, 0x45, 0x6f,
+	0x41, 0xa3, 0x76, 0x6f, 0x97, 0x74, 0x4d, 0x01, 0xd9, 0xae,
+	0xed, 0x5b, 0x6e, 0xdb, 0xd4, 0x54, 0x1d, 0x57, 0xec, 0x57,
+	0x25, 0xcd, 0x5e, 0x17, 0x27, 0xa4, 0x03, 0x21, 0x64, 0xa2,
+	0x6a, 0x4a, 0x5e, 0x11, 0x4f, 0xc6, 0x1e, 0x04, 0x32, 0x08,
+	0x25, 0xc3, 0xb6, 0xee, 0x04, 0x60, 0x6c, 0x45, 0xcb, 0xdc,
+	0x7b, 0xec, 0xaa, 0x6c, 0x0b, 0xa2, 0x99, 0x42, 0x11, 0xf7,
+	0xed, 0x47, 0x67, 0xb2, 0x29, 0xa9, 0x06, 0x21, 0x2d, 0xa4,
+	0x60, 0x26, 0xa0, 0xff, 0x2d, 0xfc, 0x72, 0xe3, 0x8c, 0x22,
+	0x6f, 0x7c, 0x9b, 0xc0, 0xd4, 0x18, 0x45, 0x91, 0xbd, 0xf1,
+	0xb5, 0x56, 0x2f, 0x06, 0x2a, 0x9a, 0xa6, 0x7c, 0x13, 0xc2,
+	0xc5, 0x74, 0xa4, 0x29, 0xf8, 0x06, 0x1a, 0x1a, 0x03, 0x85,
+	0x0a, 0x98, 0x16, 0xae, 0x79, 0x69, 0x2b, 0xcb, 0xe8, 0x5b,
+	0x4a, 0x6c, 0x1c, 0xf8, 0x18, 0x34, 0x4e, 0x6e, 0x00, 0x62,
+	0xe2, 0x77, 0x15, 0x03, 0xe5, 0xce, 0x47, 0x81, 0x22, 0x6c,
+	0xda, 0xfe, 0x29, 0x9c, 0x54, 0x9a, 0x80, 0xa6, 0xf9, 0xc9,
+	0x7b, 0x1f, 0x4f, 0xf4, 0x9e, 0x87, 0xcf, 0x2f, 0x3f, 0xc3,
+	0x4e, 0x6a, 0x60, 0x33, 0x04, 0x8d, 0xac, 0x02, 0xe3, 0x8b,
+	0xd4, 0xd9, 0xea, 0xa6, 0x07, 0x6c, 0x2d, 0x3b, 0x90, 0x82,
+	0x2c, 0x4b, 0xc2, 0x6b, 0x7f, 0xa7, 0xb6, 0x81, 0x87, 0x73,
+	0x75, 0x6e, 0x0a, 0xac, 0xd2, 0xad, 0x7c, 0x03, 0xb8, 0x41,
+	0xea, 0xeb, 0x9e, 0x6a, 0xd5, 0x35, 0x52, 0xb2, 0x3e, 0xe9,
+	0x0c, 0x45, 0x2d, 0xcc, 0x8a, 0x22, 0x91, 0xe7, 0xa4, 0x2a,
+	0x68, 0x97, 0xdc, 0xbe, 0x40, 0x66, 0x2b, 0xaf, 0x51, 0xbd,
+	0xe7, 0x6a, 0xb3, 0xcb, 0x15, 0x52, 0x49, 0xa7, 0x87, 0x1b,
+	0x7f, 0x47, 0x5b, 0x0c, 0x8e, 0x5d, 0x11, 0xdf, 0x14, 0xde,
+	0x48, 0x13, 0xfb, 0x73, 0x95, 0x8b, 0xe9, 0xa5, 0xa6, 0xba,
+	0x5e, 0x59, 0x1c, 0x3b, 0xbd, 0x57, 0x21, 0x1d, 0xd6, 0x2f,
+	0x3c, 0x94, 0x57, 0x07, 0x5e, 0xd1, 0x46, 0x68, 0x72, 0xe6,
+	0xb0, 0x21, 0x35, 0x5e, 0x9c, 0x61, 0x1f, 0xa4, 0xab, 0x01,
+	0x24, 0x41, 0xd8, 0x4e, 0xd3, 0x4b, 0x39, 0x6c, 0xf5, 0xd6,
+	0x6a, 0x0f, 0x5a, 0x95, 0xc2, 0x19, 0xcf, 0xd0, 0xf0, 0x93,
+	0xce, 0xf7, 0x6f, 0x4b, 0xf7, 0x08, 0x65, 0x35, 0xf9, 0xae,
+	0x4d, 0x86, 0x2a, 0xb2, 0x35, 0x98, 0x81, 0xd8, 0xf5, 0x17,
+	0x91, 0x7b, 0x20, 0xe1, 0x40, 0xb2, 0x44, 0x4c, 0x3c, 0x2f,
+	0x48, 0x25, 0x54, 0x04, 0xa8, 0x14, 0x52, 0x55, 0xa8, 0x76,
+	0xe6, 0xff, 0xe9, 0x15, 0xbf, 0x17, 0x4c, 0x58, 0x9f, 0xb7,
+	0x5e, 0x56, 0x60, 0x37, 0xbe, 0x07, 0x47, 0x10, 0x98, 0x34,
+	0x9b, 0xe5, 0x49, 0x1c, 0x2f, 0x80, 0xc2, 0xe4, 0x32, 0x75,
+	0xda, 0x1b, 0x26, 0xab, 0x15, 0xcc, 0x57, 0x6a, 0xc3, 0xc7,
+	0x1f, 0xa8, 0x2e, 0x36, 0x8e, 0x55, 0xc5, 0xf0, 0xa0, 0xbe,
+	0xce, 0xf5, 0xcb, 0x14, 0x9b, 0x04, 0x1e, 0xce, 0xe2, 0x90,
+	0x62, 0x83, 0x2e, 0x42, 0xd7, 0xc1, 0x68, 0x82, 0xb7, 0x0b,
+	0x8f, 0x78, 0x54, 0x50, 0x5a, 0xb7, 0xfa, 0x44, 0x67, 0x0d,
+	0x31, 0xc1, 0xde, 0x9a, 0x77, 0x87, 0x3e, 0x10, 0xee, 0x2e,
+	0x03, 0x7e, 0x38, 0x45, 0x33, 0xcd, 0x3d, 0x9c, 0x2a, 0x2f,
+	0x65, 0x20, 0xc7, 0x99, 0x74, 0xf5, 0xb2, 0xc2, 0xb5, 0xe8,
+	0xb9, 0xaf, 0xfc, 0xe8, 0x67, 0x77, 0x12, 0xce, 0xd7, 0xa6,
+	0xd8, 0xc5, 0x36, 0xd8, 0x43, 0x47, 0x8e, 0x70, 0x5a, 0x14,
+	0x27, 0xbb, 0x61, 0xa8, 0x40, 0x2f, 0xcb, 0xb2, 0x46, 0x8b,
+	0x0b, 0x99, 0xd4, 0x2d, 0x1d, 0x88, 0x54, 0xf9, 0x32, 0xb7,
+	0x02, 0x2e, 0xe8, 0x5b, 0xda, 0x6c, 0xd0, 0xa0, 0xe3, 0xd4,
+	0x5c, 0x28, 0x93, 0x97, 0x96, 0xbb, 0x19, 0xdc, 0xba, 0x55,
+	0x29, 0x46, 0xf2, 0x32, 0x0b, 0x5d, 0xe2, 0x9d, 0xc9, 0xb5,
+	0xd0, 0x75, 0xa6, 0x29, 0x74, 0xa0, 0x7f, 0x7f, 0x76, 0x50,
+	0xdf, 0x0b, 0xd1, 0x73, 0x41, 0x94, 0x84, 0xe3, 0x83, 0xba,
+	0xd7, 0xa3, 0x85, 0xf8, 0x7a, 0xb5, 0x51, 0xce, 0x61, 0x2f,
+	0x93, 0x68, 0x1d, 0xb0, 0x48, 0x48, 0xaf, 0x9c, 0x0a, 0x7a,
+	0xb1, 0xfa, 0x1b, 0x63, 0x27, 0xa4, 0x14, 0x6c, 0x2e, 0x92,
+	0x02, 0x95, 0xf8, 0x01, 0x46, 0x71, 0xfa, 0xb8, 0xb8, 0x4e,
+	0x88, 0x68, 0x43, 0xf2, 0x1c, 0xbb, 0xd5, 0xe0, 0x8c, 0x65,
+	0x8a, 0xe4, 0xb5, 0x38, 0x91, 0x0f, 0xcb, 0xeb, 0x8f, 0xd1,
+	0x3f, 0xa7, 0x33, 0x8a, 0xe5, 0xe5, 0x9f, 0xfe, 0xa4, 0x23,
+	0x79, 0x5d, 0xcb, 0x45, 0xa5, 0xca, 0x8e, 0x11, 0x8e, 0xff,
+	0x77, 0x9a, 0x9c, 0xf2, 0xf8, 0x2f, 0x6b, 0x93, 0xfe, 0xfa,
+	0xdb, 0x8f, 0x40, 0xfc, 0x93, 0x79, 0x28, 0x4d, 0xfd, 0xd1,
+	0xd6, 0x74, 0xc7, 0x4f, 0xe4, 0x06, 0x7c, 0x87, 0x2a, 0xa0,
+	0x81, 0xf6, 0x35, 0x7a, 0x86, 0xd0, 0xc4, 0xa5, 0x4c, 0x77,
+	0x8b, 0x33, 0xfa, 0xad, 0x19, 0x72, 0xc7, 0x6a, 0x01, 0xb1,
+	0x65, 0x89, 0x56, 0xb8, 0x54, 0xf4, 0xbe, 0x3e, 0x79, 0x60,
+	0xc3, 0x9d, 0xb3, 0x84, 0xbb, 0xbf, 0xa3, 0x72, 0x6f, 0xd0,
+	0x80, 0xda, 0xcb, 0x64, 0x86, 0x76, 0x13, 0xe6, 0x5c, 0x14,
+	0x8b, 0xe3, 0xd9, 0xc6, 0xed, 0xe3, 0x1a, 0x07, 0xa7, 0xfc,
+	0xfa, 0x73, 0xbc, 0x1e, 0x7a, 0xfb, 0xc5, 0x21, 0xc7, 0x05,
+	0xda, 0x97, 0x0d, 0x55, 0xc1, 0x47, 0x62, 0x5d, 0x89, 0xed,
+	0x4e, 0xc2, 0x40, 0x27, 0x29, 0x52, 0xc7, 0xa6, 0x3b, 0x6a,
+	0xeb, 0x48, 0x41, 0xde, 0x70, 0xae, 0x4b, 0x96, 0x43, 0xe4,
+	0x6d, 0x88, 0x1b, 0x07, 0x87, 0x1f, 0xb6, 0x39, 0xb8, 0xd6,
+	0x65, 0xee, 0xdd, 0x88, 0x0e, 0xe3, 0xb8, 0x4b, 0x20, 0x60,
+	0xce, 0x4c, 0xbd, 0xb6, 0x33, 0x4a, 0xfd, 0x93, 0x23, 0xdb,
+	0xb2, 0xdb, 0x67, 0x09, 0xf6, 0x1c, 0x01, 0x7a, 0xb5, 0x66,
+	0x35, 0xbd, 0xdc, 0x9f, 0x22, 0xcd, 0x58, 0xa3, 0x87, 0x56,
+	0xfb, 0x04, 0xc0, 0xd5, 0xf9, 0xb4, 0x29, 0xf4, 0x85, 0x6a,
+	0x42, 0x76, 0xad, 0x41, 0xf7, 0x76, 0xdd, 0x09, 0xe7, 0xb6,
+	0xb8, 0xda, 0xae, 0xf4, 0xf7, 0x8f, 0x64, 0xcd, 0xb1, 0x9e,
+	0x67, 0x21, 0xf3, 0xc4, 0x83, 0x48, 0x7c, 0x47, 0xaa, 0x0e,
+	0x64, 0xd4, 0x81, 0x87, 0xd4, 0xce, 0x06, 0x06, 0x79, 0x05,
+	0x96, 0x51, 0x81, 0xc6, 0xf0, 0x43, 0x9c, 0xe3, 0xf5, 0x63,
+	0x08, 0x85, 0x4e, 0x37, 0x0d, 0xc7, 0xcd, 0x36, 0x6d, 0x22,
+	0x3d, 0xf5, 0x2e, 0xbd, 0xd6, 0x71, 0xbc, 0xf9, 0x7f, 0x08,
+	0x1a, 0x2b, 0x98, 0x00, 0x57, 0x62, 0xc6, 0xdb, 0xe3, 0x4b,
+	0x83, 0x84, 0x45, 0x1a, 0x2d, 0x97, 0xc0, 0x8e, 0xd3, 0x38,
+	0xe3, 0x61, 0x23, 0xd1, 0x2c, 0x6d, 0x0f, 0x5b, 0xa3, 0xd4,
+	0xd1, 0x6a, 0xfa, 0x5c, 0x6a, 0x8e, 0xa5, 0xe4, 0x78, 0x6c,
+	0xad, 0x31, 0xcd, 0x5c, 0x78, 0x6f, 0x69, 0x8e, 0x97, 0xfc,
+	0x40, 0xea, 0x6c, 0xe3, 0xc4, 0x05, 0xad, 0x19, 0x3d, 0x4d,
+	0x3d, 0xfc, 0x7c, 0x05, 0x66, 0x1c, 0x79, 0x98, 0xf1, 0xc4,
+	0x45, 0xc7, 0x93, 0x09, 0xd4, 0x9b, 0x76, 0x6d, 0x05, 0x3e,
+	0x39, 0x0b, 0x21, 0xd5, 0x6e, 0x5f, 0x1f, 0xbb, 0x27, 0x88,
+	0x10, 0x92, 0xa4, 0xe1, 0x0f, 0x23, 0x49, 0x97, 0x13, 0x3f,
+	0xba, 0x99, 0xc8, 0xc2, 0x1e, 0xf2, 0x80, 0xde, 0xf4, 0xda,
+	0xbd, 0xbf, 0x91, 0xcc, 0xb2, 0x98, 0x68, 0x8e, 0x2e, 0x4e,
+	0x26, 0xe1, 0x0f, 0x37, 0xa3, 0x4b, 0x14, 0x55, 0x75, 0xff,
+	0x0f, 0xd4, 0x6c, 0x4d, 0x86, 0xcd, 0x88, 0xe4, 0xd7, 0x99,
+	0xa0, 0x09, 0xf4, 0x44, 0x4e, 0xd4, 0x4b, 0xcc, 0x18, 0x65,
+	0xdc, 0xef, 0xf0, 0x79, 0x91, 0xc4, 0x49, 0xdc, 0x9e, 0xd9,
+	0x0c, 0x9b, 0xb3, 0xa3, 0x65, 0x77, 0x38, 0x89, 0xb2, 0xe9,
+	0x7a, 0xe6, 0xc9, 0xe1, 0xac, 0x08, 0x09, 0xcc, 0x82, 0x31,
+	0x56, 0x09, 0xb3, 0x6c, 0xa5, 0x10, 0x38, 0xf9, 0xbd, 0x2a,
+	0x79, 0xd6, 0xbf, 0x57, 0xf9, 0x27, 0x1c, 0xfe, 0xd8, 0xcc,
+	0xf7, 0x59, 0x86, 0x39, 0xff, 0x8c, 0xd0, 0xf3, 0xec, 0x67,
+	0x83, 0x0e, 0x3b, 0x08, 0xfd, 0x0b, 0xc0, 0x6a, 0x4b, 0x7c,
+	0x46, 0x1c, 0x00, 0x00
+};
+
 static const unsigned char httpsrv_fs_webui_webconfig_js[] = {
 	/* webui/webconfig.js */
 	0x76, 0x61, 0x72, 0x20, 0x67, 0x5f, 0x73, 0x74, 0x61, 0x74,
@@ -3552,12 +3986,450 @@ static const unsigned char httpsrv_fs_webui_webconfig_js[] = {
 	0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x7d, 0x0d, 0x0a
 };
 
+static const unsigned char httpsrv_fs_webui_webconfig_js_gz[] = {
+	/* webui/webconfig.js.gz */
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+	0xd5, 0x1b, 0x69, 0x6f, 0xdb, 0x46, 0xf6, 0xfb, 0x02, 0xfd,
+	0x0f, 0x53, 0x22, 0xa8, 0xa8, 0x46, 0xa6, 0x9c, 0xa6, 0x2d,
+	0x8a, 0xf8, 0x58, 0xd8, 0xae, 0x93, 0xb8, 0x88, 0x1d, 0xa3,
+	0x76, 0x91, 0xdd, 0x35, 0x02, 0x7b, 0x44, 0x8e, 0x24, 0xd6,
+	0x14, 0x47, 0x1d, 0x52, 0x56, 0x54, 0x47, 0xff, 0x7d, 0xdf,
+	0x9b, 0x8b, 0xc3, 0x4b, 0x87, 0x9b, 0x02, 0xbb, 0x6e, 0xe1,
+	0x48, 0xe4, 0xcc, 0x9b, 0x77, 0x9f, 0xe3, 0x07, 0x2a, 0xc8,
+	0xe8, 0x36, 0xcb, 0x69, 0xce, 0xc8, 0x01, 0xf1, 0xe8, 0xd4,
+	0xdb, 0xfb, 0xea, 0x1f, 0xf8, 0xdf, 0x70, 0x96, 0x86, 0x79,
+	0xcc, 0x53, 0x12, 0x8e, 0x59, 0x78, 0x7f, 0x36, 0x7c, 0x1d,
+	0x0b, 0x36, 0xe4, 0x9f, 0xfc, 0xee, 0xe3, 0x57, 0xff, 0x20,
+	0x24, 0x1e, 0xfa, 0x29, 0x7d, 0x88, 0x47, 0x34, 0xe7, 0x22,
+	0x98, 0x65, 0x4c, 0x1c, 0x8d, 0x58, 0x9a, 0x07, 0x39, 0x7f,
+	0xc7, 0xe7, 0x4c, 0x9c, 0xd0, 0x8c, 0xf9, 0xdd, 0x20, 0x4e,
+	0x23, 0xf6, 0xe9, 0xfd, 0xd0, 0xef, 0x0c, 0xd5, 0xde, 0x4e,
+	0x97, 0x1c, 0x92, 0x9d, 0x17, 0x0a, 0x02, 0x21, 0x7c, 0xca,
+	0xd2, 0x5b, 0x26, 0x04, 0x17, 0xb7, 0x51, 0x4c, 0x13, 0x3e,
+	0x9a, 0x31, 0xdf, 0xd3, 0xc7, 0x90, 0x38, 0x23, 0x29, 0xcf,
+	0x49, 0x36, 0x9b, 0x4e, 0xb9, 0xc8, 0x59, 0x44, 0x06, 0x0b,
+	0x92, 0x8f, 0xe1, 0x29, 0x9d, 0x4e, 0x93, 0x38, 0xa4, 0x88,
+	0x5a, 0x40, 0x7e, 0xcb, 0x18, 0x39, 0x8f, 0x43, 0xc1, 0x33,
+	0x3e, 0xcc, 0xc9, 0x69, 0x34, 0x62, 0x84, 0x0b, 0xf2, 0x86,
+	0xf3, 0x51, 0xc2, 0xc8, 0xc9, 0x58, 0xf0, 0x09, 0x0b, 0xbc,
+	0x9e, 0x3a, 0x8e, 0x10, 0xef, 0x58, 0xf0, 0x39, 0xe0, 0x5a,
+	0x86, 0xec, 0x75, 0xf7, 0x70, 0xc1, 0x12, 0x7f, 0x65, 0x21,
+	0x4d, 0x7d, 0xfc, 0xbe, 0xac, 0x30, 0x21, 0x1b, 0xf3, 0xf9,
+	0x25, 0xcd, 0xb2, 0x39, 0x17, 0x91, 0xdf, 0x25, 0x92, 0x82,
+	0x07, 0x60, 0xdd, 0x27, 0x60, 0x5a, 0xc4, 0xc3, 0xd9, 0x04,
+	0xa9, 0x1f, 0xb1, 0xfc, 0x34, 0x61, 0xf8, 0xf1, 0x78, 0x71,
+	0x16, 0xf9, 0xde, 0x94, 0x67, 0xf9, 0xed, 0x54, 0xef, 0xd2,
+	0xc7, 0xc4, 0x43, 0xe2, 0x7f, 0x0a, 0xf2, 0xc5, 0x14, 0xd8,
+	0x7d, 0x00, 0x0c, 0x2f, 0x5e, 0x13, 0xcd, 0x16, 0xf3, 0x96,
+	0x78, 0x39, 0xfb, 0x94, 0x7b, 0x0a, 0x39, 0xc2, 0x12, 0x20,
+	0xb5, 0xb6, 0xc2, 0xee, 0x36, 0x24, 0x2c, 0x4b, 0x58, 0x4f,
+	0xf9, 0x74, 0x96, 0x80, 0x64, 0x3f, 0xc4, 0xc3, 0xf8, 0x82,
+	0xe5, 0xb0, 0xf2, 0x3e, 0xf3, 0x53, 0xfd, 0xc1, 0x1e, 0x88,
+	0x74, 0xf0, 0xc1, 0xef, 0x2c, 0xcc, 0x3f, 0x5c, 0xac, 0x22,
+	0x67, 0x0e, 0x50, 0x6e, 0x93, 0x38, 0xcb, 0x35, 0x29, 0x8a,
+	0x98, 0x74, 0x96, 0x24, 0x40, 0x0a, 0xb1, 0x60, 0x1f, 0x0d,
+	0xbb, 0x5b, 0x24, 0x7c, 0x05, 0x42, 0x01, 0x49, 0xa6, 0x23,
+	0x32, 0x07, 0xd0, 0x64, 0x2e, 0x38, 0x7c, 0x8c, 0x66, 0x02,
+	0x9f, 0xe4, 0x63, 0x26, 0x65, 0x10, 0x90, 0xcb, 0x84, 0x81,
+	0x12, 0x91, 0x5c, 0x2c, 0x08, 0x1d, 0xd1, 0x38, 0x45, 0xb9,
+	0x4a, 0x4d, 0x94, 0x6b, 0x00, 0x54, 0x06, 0x82, 0x25, 0xde,
+	0x15, 0x2c, 0x26, 0x43, 0x1a, 0x27, 0x56, 0x8e, 0xea, 0x47,
+	0xb0, 0x7c, 0x26, 0x52, 0xfd, 0x40, 0x0b, 0x53, 0x61, 0xec,
+	0xef, 0x4a, 0xc6, 0x1b, 0x74, 0x83, 0x84, 0xa5, 0xa3, 0x7c,
+	0x6c, 0x99, 0x21, 0xd1, 0xd6, 0xcc, 0x00, 0x05, 0x4e, 0x99,
+	0x78, 0x7b, 0x7d, 0xfe, 0x8e, 0x20, 0xb3, 0xf7, 0xa3, 0xf8,
+	0x81, 0xc4, 0xd1, 0x41, 0x47, 0x32, 0x22, 0xe5, 0xb7, 0x06,
+	0x46, 0xe7, 0xf0, 0x82, 0x13, 0xc3, 0x5f, 0x72, 0xf4, 0x00,
+	0xe8, 0xd0, 0x41, 0xc2, 0xf6, 0xfb, 0xb0, 0xe1, 0xd0, 0x5b,
+	0x89, 0x15, 0x7e, 0xe8, 0xf7, 0xc9, 0x39, 0x15, 0xf7, 0xe4,
+	0x87, 0x37, 0xe3, 0x3f, 0x2d, 0x5e, 0xea, 0x95, 0xc5, 0x72,
+	0xc8, 0xc5, 0x29, 0x0d, 0xc7, 0x3e, 0x4a, 0xaf, 0x7b, 0x70,
+	0xe8, 0x20, 0x8b, 0x96, 0xc8, 0xf2, 0x20, 0x1c, 0x53, 0x40,
+	0x36, 0x01, 0x03, 0x7b, 0xf1, 0xd2, 0x15, 0x81, 0x86, 0x12,
+	0xc4, 0xd9, 0x0f, 0x6f, 0xde, 0xfe, 0x09, 0x64, 0xe4, 0x62,
+	0xc6, 0xf6, 0xca, 0xef, 0x01, 0x81, 0x6b, 0x34, 0x2d, 0xf8,
+	0x1f, 0x4c, 0x39, 0x22, 0x19, 0x07, 0x26, 0xd3, 0xdc, 0x15,
+	0x4a, 0x34, 0xb3, 0x56, 0x47, 0x86, 0x60, 0xd7, 0xf0, 0xbc,
+	0x07, 0xf2, 0x03, 0x65, 0x49, 0x3b, 0x39, 0xd0, 0x35, 0xe1,
+	0x0f, 0x0c, 0x08, 0xb0, 0x08, 0x93, 0x79, 0x9c, 0x8f, 0x49,
+	0x46, 0x27, 0x8c, 0xa4, 0xf8, 0x8b, 0x66, 0xe4, 0xbb, 0xe0,
+	0x7b, 0xf9, 0x3e, 0xab, 0x23, 0x97, 0x65, 0x71, 0xf4, 0x01,
+	0x36, 0x68, 0x14, 0xcd, 0x23, 0xf2, 0x9c, 0x78, 0xf8, 0x48,
+	0xb3, 0xf6, 0x1d, 0x1d, 0xb0, 0x64, 0xff, 0x37, 0xc4, 0x30,
+	0xe7, 0x24, 0x02, 0x45, 0x04, 0x2c, 0x66, 0x71, 0x36, 0x56,
+	0xa0, 0x69, 0x1a, 0x49, 0x16, 0x96, 0x38, 0x5e, 0x36, 0x9c,
+	0x46, 0x86, 0x0c, 0x29, 0xac, 0xd8, 0xdb, 0x18, 0x29, 0x17,
+	0xb8, 0x16, 0x64, 0x77, 0xcf, 0x11, 0xe5, 0x15, 0x38, 0x15,
+	0x82, 0x06, 0xe7, 0x68, 0x44, 0x32, 0x1d, 0x03, 0xee, 0x39,
+	0x30, 0x30, 0x49, 0x16, 0x76, 0xe5, 0xe5, 0x0c, 0x50, 0x87,
+	0x27, 0xe4, 0x34, 0xcd, 0x99, 0x98, 0x8a, 0x18, 0x10, 0x45,
+	0x22, 0xc6, 0x71, 0x14, 0xb1, 0xb4, 0x60, 0x65, 0xce, 0xa5,
+	0x08, 0x06, 0x3c, 0xcf, 0xf9, 0xc4, 0xee, 0x3e, 0x1b, 0x92,
+	0xc9, 0x2c, 0xc9, 0xe3, 0x29, 0x78, 0x3a, 0x74, 0xdf, 0x20,
+	0x19, 0x97, 0xeb, 0x57, 0x57, 0x67, 0x3f, 0x13, 0x2a, 0x18,
+	0x19, 0xf2, 0x59, 0x1a, 0xf5, 0x40, 0xa6, 0x80, 0x16, 0x80,
+	0x99, 0x10, 0x1a, 0x86, 0xe0, 0x31, 0xa4, 0x60, 0x39, 0xc9,
+	0xe2, 0x51, 0x4a, 0x13, 0x00, 0x20, 0xa4, 0x19, 0x54, 0xb4,
+	0x0e, 0x37, 0xf9, 0x3e, 0xed, 0x91, 0x81, 0xd2, 0xb9, 0x82,
+	0x74, 0x43, 0xa8, 0x83, 0xfa, 0x2a, 0x7c, 0xf1, 0x27, 0x61,
+	0x39, 0xae, 0x39, 0x02, 0x5e, 0xf6, 0x4f, 0x2f, 0xae, 0xfb,
+	0x71, 0x90, 0xb3, 0x2c, 0xf7, 0x69, 0x90, 0xb1, 0x10, 0x14,
+	0x2d, 0x5f, 0xb8, 0xf6, 0xab, 0x17, 0x1f, 0x57, 0x16, 0x0f,
+	0x4a, 0x8b, 0xab, 0x46, 0x70, 0x64, 0x2c, 0xfb, 0xb8, 0xc1,
+	0x02, 0xf0, 0x5c, 0x2a, 0x25, 0x08, 0x51, 0xea, 0xb7, 0xe9,
+	0xd4, 0x44, 0xa9, 0xba, 0xe4, 0xf1, 0xd0, 0x41, 0xf3, 0xca,
+	0x9a, 0xdd, 0x48, 0x26, 0xbc, 0x55, 0x02, 0xbb, 0x58, 0xc3,
+	0x00, 0xeb, 0x31, 0x0d, 0xa6, 0x9e, 0x47, 0xbe, 0xf9, 0x46,
+	0x9d, 0xf8, 0xb5, 0xfc, 0x5a, 0x45, 0xbb, 0xf0, 0x19, 0xe4,
+	0x45, 0x05, 0xcf, 0x65, 0x0b, 0xdc, 0xaf, 0xcb, 0x70, 0x0f,
+	0xd6, 0xc1, 0xdd, 0x69, 0x00, 0x5c, 0xa3, 0x52, 0x7a, 0x26,
+	0xf0, 0x0e, 0x51, 0x3c, 0x1c, 0x32, 0x81, 0xb1, 0x01, 0x7e,
+	0x1a, 0x38, 0xfc, 0x1c, 0x59, 0xac, 0x0d, 0xeb, 0x9f, 0x0d,
+	0xb6, 0x7b, 0xe8, 0x91, 0x57, 0x80, 0x4e, 0x13, 0xcb, 0x9f,
+	0x23, 0xcf, 0x37, 0xda, 0x5a, 0xc3, 0x0e, 0x2c, 0xc1, 0xaa,
+	0xbc, 0x56, 0x74, 0x48, 0x16, 0x1a, 0x35, 0x7b, 0x53, 0x7d,
+	0x71, 0x74, 0xe6, 0x9c, 0xe6, 0xe3, 0x80, 0x0e, 0x32, 0x7f,
+	0x4a, 0x45, 0xc6, 0xce, 0x52, 0xa9, 0xb1, 0x12, 0x76, 0x20,
+	0xd8, 0x34, 0xa1, 0x21, 0xf3, 0xfb, 0x37, 0x74, 0xe7, 0xcf,
+	0xde, 0xd1, 0xce, 0x7f, 0x3e, 0xf6, 0xc1, 0x2b, 0x76, 0x3a,
+	0xdd, 0x6e, 0x55, 0xab, 0x1c, 0xcd, 0xaa, 0xc3, 0x1b, 0x6c,
+	0x0f, 0x6f, 0x59, 0x73, 0x42, 0x8e, 0x48, 0x15, 0x69, 0xfb,
+	0x8a, 0x30, 0x60, 0xe6, 0xce, 0x0b, 0x60, 0x9d, 0x7a, 0x78,
+	0x68, 0x1f, 0xe2, 0xb3, 0x5d, 0xcb, 0xcd, 0x65, 0xb7, 0x1a,
+	0x8c, 0xd0, 0x2f, 0x19, 0xa7, 0xcf, 0x56, 0x45, 0xa3, 0x1e,
+	0x91, 0x69, 0x5e, 0x0f, 0x9c, 0x8d, 0xa0, 0x8b, 0x6a, 0x6c,
+	0x22, 0xbe, 0x7c, 0x2b, 0xd5, 0x72, 0xb7, 0x5b, 0xf5, 0xc3,
+	0x3a, 0x76, 0x95, 0x3d, 0xed, 0x81, 0x82, 0x74, 0x23, 0x37,
+	0xee, 0xbc, 0xf8, 0x58, 0x7a, 0xdd, 0x22, 0xa8, 0xc0, 0xa2,
+	0xda, 0x1c, 0xe1, 0x6a, 0xc1, 0x77, 0x35, 0x23, 0xab, 0x10,
+	0xdd, 0x10, 0xa1, 0xbd, 0xbd, 0xe1, 0x97, 0x76, 0x54, 0xb7,
+	0xe3, 0x7c, 0x92, 0x60, 0x92, 0x60, 0x94, 0x7b, 0x83, 0xc8,
+	0x8d, 0x5b, 0x39, 0x38, 0x0a, 0x71, 0x92, 0x40, 0x1a, 0xc7,
+	0x32, 0xd8, 0xde, 0xe9, 0x54, 0x7c, 0x20, 0x44, 0x39, 0xd0,
+	0x89, 0x05, 0x44, 0xd6, 0x86, 0x97, 0x98, 0x5e, 0x55, 0xdc,
+	0x20, 0x51, 0x0c, 0xd5, 0x4e, 0x32, 0xc8, 0x45, 0x3c, 0x81,
+	0x74, 0x55, 0xf9, 0x84, 0xcf, 0x9f, 0x49, 0xdb, 0xcb, 0xf7,
+	0x00, 0xa9, 0xe6, 0x25, 0x10, 0x7c, 0x33, 0x3b, 0x5d, 0x30,
+	0xc4, 0x6c, 0x5f, 0x1b, 0x75, 0x35, 0xbc, 0xd6, 0x78, 0x5b,
+	0x00, 0x6c, 0x40, 0xb3, 0x1c, 0x76, 0x1b, 0x48, 0xc6, 0x7c,
+	0x41, 0x39, 0xbb, 0xa6, 0x68, 0xaf, 0x5e, 0x13, 0xef, 0x46,
+	0xfb, 0x6a, 0xf4, 0x15, 0x1f, 0xab, 0x8e, 0xa8, 0x24, 0x0c,
+	0x70, 0x48, 0x1d, 0x15, 0x89, 0x4d, 0x9e, 0x47, 0x3a, 0x6d,
+	0x48, 0xa0, 0x30, 0x58, 0x11, 0x09, 0xcb, 0x31, 0xcb, 0x25,
+	0xa6, 0x16, 0xb5, 0x8a, 0x5d, 0x35, 0xb4, 0x6b, 0xd8, 0x14,
+	0x6b, 0xd7, 0x63, 0x64, 0xcc, 0xb8, 0xd0, 0xe2, 0x72, 0x62,
+	0xe9, 0x58, 0x9f, 0x5d, 0xb2, 0x16, 0x03, 0xcf, 0x2e, 0xb5,
+	0x08, 0x78, 0x2b, 0x10, 0x90, 0x8e, 0x5b, 0xc5, 0x8e, 0x8b,
+	0xb6, 0xc3, 0x95, 0xc7, 0xaf, 0x6a, 0x9e, 0xab, 0xf5, 0xde,
+	0x0d, 0xae, 0x58, 0x2b, 0x2b, 0x59, 0x9d, 0xe0, 0xca, 0xf5,
+	0xa8, 0x59, 0x73, 0x85, 0x6d, 0x77, 0x32, 0xa9, 0x0f, 0x11,
+	0xce, 0x81, 0x2a, 0x70, 0xcc, 0xf6, 0x67, 0x8f, 0xee, 0x11,
+	0x4b, 0x8f, 0xf0, 0x34, 0x04, 0xe2, 0xef, 0x0f, 0x3a, 0x21,
+	0x87, 0x4c, 0x3b, 0xcc, 0x71, 0xa5, 0xef, 0x3d, 0x7b, 0x34,
+	0xea, 0xb5, 0x84, 0x7a, 0x04, 0x36, 0x81, 0x92, 0x2f, 0xf1,
+	0x43, 0x21, 0x2d, 0xf8, 0x6a, 0x96, 0x69, 0x35, 0x58, 0x7a,
+	0xdd, 0xce, 0x61, 0xdd, 0x43, 0xc9, 0x9f, 0xfd, 0x6c, 0x0a,
+	0x25, 0x4d, 0x03, 0x46, 0xb7, 0x0f, 0x34, 0x99, 0x31, 0x52,
+	0x7a, 0x84, 0xe7, 0x7a, 0x87, 0x0e, 0x0e, 0xc4, 0xaf, 0x9c,
+	0xd4, 0x05, 0x54, 0x2c, 0x3b, 0x97, 0xfb, 0x7d, 0x84, 0xde,
+	0x7a, 0xf4, 0x40, 0xb4, 0xbd, 0xd2, 0x68, 0x35, 0xe2, 0x95,
+	0xa0, 0x9c, 0xbd, 0xc3, 0x63, 0xb4, 0xa9, 0x57, 0xfa, 0x84,
+	0xb5, 0x74, 0x18, 0xac, 0x07, 0x12, 0xed, 0x95, 0x78, 0xb5,
+	0xa3, 0xb5, 0x1e, 0xa9, 0x13, 0x55, 0x16, 0x6d, 0x8d, 0x96,
+	0x2e, 0xa7, 0xfe, 0x1a, 0x62, 0x2b, 0xf0, 0xba, 0x52, 0xd9,
+	0xc9, 0x95, 0xce, 0x4e, 0x2c, 0x7e, 0x1b, 0xa2, 0xa7, 0x12,
+	0x86, 0xa7, 0x60, 0xa7, 0x8a, 0xd2, 0x3b, 0x27, 0xf2, 0x6b,
+	0x33, 0x69, 0x28, 0x7a, 0x0f, 0xac, 0xa9, 0xe8, 0x35, 0x80,
+	0x6c, 0xc4, 0xc4, 0xcf, 0x36, 0x2d, 0x00, 0xb7, 0x2c, 0x93,
+	0xe0, 0x31, 0x9f, 0xf7, 0xc1, 0xb1, 0xb2, 0x52, 0xc6, 0xd0,
+	0xd6, 0x8c, 0x38, 0xe6, 0x54, 0x44, 0x67, 0xe9, 0x90, 0xfb,
+	0x11, 0xcd, 0xa9, 0x31, 0xfd, 0xd6, 0xae, 0xc3, 0x00, 0x97,
+	0x5f, 0x40, 0x7e, 0xe7, 0x75, 0x4b, 0xa8, 0xe1, 0xe6, 0x1b,
+	0x0f, 0x8b, 0x4b, 0xef, 0xe3, 0xde, 0x26, 0x30, 0xce, 0x2e,
+	0x1b, 0x21, 0xc4, 0x53, 0xb9, 0xdf, 0xb6, 0x07, 0xf0, 0x69,
+	0x80, 0x05, 0xd5, 0x2c, 0x93, 0xf1, 0x04, 0x8c, 0x1e, 0xe0,
+	0x94, 0x82, 0x63, 0xeb, 0x39, 0x6a, 0xdb, 0x11, 0x1e, 0x24,
+	0x45, 0xf8, 0x0e, 0x6a, 0xd4, 0x40, 0x15, 0xc7, 0xbe, 0x47,
+	0x81, 0x0d, 0x0f, 0x40, 0xc5, 0xc6, 0x70, 0x4e, 0xde, 0x9d,
+	0x95, 0x00, 0xd1, 0x28, 0x6a, 0x82, 0xe2, 0x74, 0xef, 0x34,
+	0xae, 0x26, 0x53, 0xa9, 0x45, 0xe1, 0x2d, 0x0f, 0x7c, 0x32,
+	0xe6, 0x15, 0x0e, 0xac, 0x47, 0x5c, 0xb5, 0x1d, 0xad, 0xa7,
+	0x2e, 0x2b, 0x4e, 0x5d, 0xeb, 0x1e, 0x4b, 0xb9, 0x57, 0xd6,
+	0xdc, 0xb4, 0xca, 0x8e, 0x17, 0xd2, 0x79, 0xa3, 0xee, 0xf8,
+	0xf5, 0xd0, 0x65, 0xdb, 0x45, 0x08, 0x25, 0xcb, 0x17, 0x89,
+	0x44, 0xc4, 0x73, 0xf2, 0x60, 0xa8, 0x2b, 0xb0, 0x8c, 0x53,
+	0x5d, 0xa7, 0x81, 0xea, 0x49, 0xca, 0x2f, 0x0c, 0xea, 0x69,
+	0xed, 0x53, 0x9d, 0x00, 0x6b, 0x8a, 0xf0, 0x42, 0x93, 0xda,
+	0x98, 0x04, 0xb9, 0x35, 0x62, 0x91, 0x21, 0x93, 0x14, 0x3c,
+	0x57, 0xbb, 0x2c, 0x2e, 0x83, 0x84, 0x87, 0xf7, 0xed, 0xc2,
+	0xb4, 0xeb, 0x52, 0x9e, 0x32, 0xaf, 0xda, 0x54, 0x82, 0xb4,
+	0xd3, 0x47, 0xca, 0x62, 0x58, 0xb1, 0xbb, 0x07, 0xff, 0xc8,
+	0x7a, 0xc0, 0xb4, 0xbb, 0xe0, 0xc1, 0xf3, 0xe7, 0xee, 0xa1,
+	0xf8, 0xee, 0x26, 0x86, 0x5c, 0x1b, 0x81, 0x06, 0x86, 0xb8,
+	0x03, 0x75, 0x88, 0x05, 0x5d, 0x96, 0x8b, 0x1b, 0x07, 0xd1,
+	0x8b, 0xf7, 0x64, 0x86, 0xd7, 0xc3, 0x4c, 0x08, 0xca, 0x30,
+	0x93, 0xf1, 0x3c, 0x16, 0xad, 0x42, 0x9b, 0xa3, 0x95, 0xb3,
+	0xb0, 0x5a, 0xc7, 0x30, 0x9b, 0x85, 0x21, 0xcb, 0x32, 0xa7,
+	0x67, 0x78, 0xa2, 0x8e, 0xd2, 0x4d, 0x8b, 0x71, 0xb1, 0x3b,
+	0xab, 0x35, 0x8a, 0x65, 0x5b, 0xb0, 0xbc, 0xde, 0x39, 0x6d,
+	0x4d, 0x93, 0xb0, 0xc8, 0xca, 0xb6, 0x46, 0xaa, 0xa9, 0x13,
+	0xb2, 0x01, 0x6e, 0xce, 0xb6, 0x0f, 0xf1, 0xce, 0xeb, 0x78,
+	0x23, 0x04, 0x89, 0x6f, 0x6d, 0xc7, 0xf1, 0x50, 0xa4, 0x8a,
+	0x72, 0xf8, 0x0b, 0x8f, 0xd3, 0x02, 0xe1, 0x4d, 0xfa, 0xa3,
+	0xab, 0x7b, 0xd9, 0x32, 0xdd, 0xe8, 0x06, 0x2a, 0x11, 0x01,
+	0xe5, 0x28, 0xda, 0x61, 0x6b, 0xf6, 0x69, 0x65, 0x70, 0xf7,
+	0xea, 0x47, 0x1b, 0xed, 0x2f, 0x9a, 0xe4, 0x76, 0xbf, 0x2d,
+	0xb4, 0x56, 0xef, 0x94, 0xcd, 0xe7, 0xac, 0xe2, 0xf8, 0xed,
+	0x5e, 0xe4, 0xd2, 0xcf, 0x56, 0x9e, 0x74, 0x6a, 0x0f, 0x82,
+	0x0f, 0x23, 0x06, 0xc2, 0xc2, 0xda, 0xa7, 0xeb, 0x28, 0x06,
+	0x6e, 0xd8, 0x28, 0x12, 0x58, 0x40, 0x71, 0x3a, 0x9d, 0xe5,
+	0xb7, 0xc3, 0x98, 0x25, 0x88, 0x7d, 0xd5, 0xbc, 0xac, 0xed,
+	0x6e, 0xed, 0xb1, 0x37, 0x3d, 0xa0, 0xec, 0x44, 0xac, 0x73,
+	0x2d, 0x19, 0x32, 0xf0, 0x34, 0x86, 0xb0, 0xc7, 0x5e, 0x73,
+	0x31, 0xf1, 0xad, 0x1a, 0xad, 0xf2, 0x60, 0x35, 0x6d, 0xd0,
+	0x7e, 0x85, 0xd4, 0xca, 0xfc, 0xa7, 0x88, 0x47, 0xf6, 0x2e,
+	0x43, 0x8a, 0x9d, 0xe5, 0x01, 0x23, 0x83, 0x84, 0xa6, 0xf7,
+	0x41, 0xbd, 0x8d, 0x5e, 0xae, 0xca, 0xcb, 0x7e, 0x7b, 0xce,
+	0xc8, 0x98, 0x3e, 0x60, 0x3b, 0x55, 0x55, 0x9d, 0x54, 0xda,
+	0x2e, 0xa4, 0x20, 0x31, 0xfa, 0xa6, 0x88, 0xa7, 0xb9, 0x76,
+	0xeb, 0x86, 0x8d, 0x1b, 0x90, 0xbc, 0x11, 0xc3, 0x2d, 0xc7,
+	0x4b, 0x4c, 0x58, 0xcb, 0xca, 0xaa, 0x82, 0xb7, 0xb2, 0xf3,
+	0xa9, 0x2c, 0x35, 0xb3, 0xab, 0x55, 0x6c, 0x6d, 0x61, 0x6d,
+	0x43, 0xc9, 0xfd, 0x44, 0x6a, 0xf6, 0xc9, 0x4f, 0x5f, 0x96,
+	0x98, 0xc9, 0x2c, 0x93, 0xb4, 0xd0, 0x9c, 0xe0, 0xb8, 0x28,
+	0x27, 0x3f, 0x81, 0x58, 0xa9, 0x80, 0x54, 0x83, 0x89, 0x6c,
+	0x0b, 0xda, 0xfe, 0x32, 0x65, 0x87, 0xe4, 0xc7, 0x97, 0x7f,
+	0x87, 0x9c, 0xa4, 0x12, 0x4f, 0xb8, 0x60, 0x38, 0x90, 0x49,
+	0xe1, 0x90, 0xa7, 0xd1, 0x57, 0x73, 0xf3, 0x61, 0xc2, 0x33,
+	0xb6, 0xc2, 0xf3, 0x15, 0x7d, 0x0a, 0x9a, 0xe7, 0x6c, 0x32,
+	0xcd, 0x75, 0xd0, 0x72, 0x9a, 0xe0, 0xfa, 0x34, 0xdd, 0x1d,
+	0xaa, 0xce, 0x4b, 0x27, 0xf7, 0xbf, 0xb2, 0x3f, 0x66, 0xd8,
+	0xfe, 0xc0, 0x61, 0x1f, 0x87, 0xdc, 0x60, 0x26, 0x92, 0x1e,
+	0x98, 0x9b, 0xa0, 0x93, 0xac, 0x47, 0xc2, 0x01, 0xf8, 0xd6,
+	0x78, 0xc2, 0xf8, 0xcc, 0x06, 0x5a, 0x9c, 0x42, 0x0a, 0xf6,
+	0x87, 0x2c, 0x3a, 0xe6, 0xe4, 0x5f, 0xe7, 0xef, 0xde, 0xe6,
+	0xf9, 0xd4, 0x00, 0xe9, 0xda, 0x02, 0xe4, 0x8f, 0x00, 0x0d,
+	0xda, 0x85, 0x6a, 0xc3, 0x9a, 0x86, 0x80, 0x1b, 0xae, 0x15,
+	0x6c, 0x19, 0x67, 0xcc, 0x17, 0xdf, 0x2f, 0xb7, 0xdf, 0xc2,
+	0x81, 0x8f, 0x27, 0x9d, 0xa2, 0x1c, 0x7c, 0x4f, 0x63, 0xe3,
+	0x75, 0x7b, 0x04, 0x27, 0x9a, 0x06, 0xe8, 0xb2, 0xc0, 0xd3,
+	0xa1, 0x1c, 0x90, 0x48, 0x13, 0x4e, 0xb1, 0xa3, 0x64, 0x28,
+	0xf6, 0xdd, 0xb0, 0x10, 0x82, 0x36, 0x0a, 0x73, 0x6c, 0x19,
+	0x25, 0x37, 0x08, 0x23, 0x06, 0x70, 0x56, 0x4f, 0x42, 0x14,
+	0x2c, 0x9b, 0x42, 0xf6, 0xc8, 0xba, 0x85, 0x47, 0x2b, 0x0e,
+	0x93, 0xca, 0xf2, 0xd7, 0x4f, 0x73, 0xcf, 0xa9, 0xd0, 0x59,
+	0x9c, 0x96, 0x41, 0xba, 0xed, 0x2b, 0x41, 0xd9, 0x49, 0xb8,
+	0x95, 0x2b, 0xa8, 0x72, 0x51, 0xbf, 0x85, 0x03, 0xab, 0xf3,
+	0x85, 0xbc, 0xbd, 0x37, 0xa7, 0xd7, 0x5e, 0x4f, 0x17, 0x02,
+	0x41, 0x38, 0x8a, 0xbd, 0x9e, 0x24, 0xd2, 0x07, 0x1a, 0x7a,
+	0xb2, 0xe6, 0xba, 0x55, 0xef, 0x6a, 0xd2, 0xa8, 0x2d, 0x28,
+	0x64, 0xf0, 0x62, 0x77, 0x77, 0xb7, 0x8e, 0x4c, 0x55, 0x37,
+	0xed, 0x84, 0x4a, 0x66, 0x3f, 0x13, 0x1e, 0xb1, 0xdb, 0x6c,
+	0x1e, 0xe7, 0xe1, 0xb8, 0x9c, 0x03, 0x15, 0xfa, 0xa6, 0xbb,
+	0x82, 0x5b, 0x64, 0x3d, 0x7b, 0xc5, 0x66, 0x63, 0x31, 0xeb,
+	0x01, 0x54, 0xbd, 0x86, 0x03, 0xc4, 0x69, 0x7a, 0x6e, 0x99,
+	0x43, 0x95, 0x30, 0x41, 0x61, 0x01, 0x88, 0x3b, 0x8b, 0xef,
+	0xc1, 0xb3, 0x47, 0xd9, 0x58, 0xf9, 0xc6, 0x22, 0x30, 0x1d,
+	0x0b, 0x9a, 0x31, 0x78, 0x6e, 0xb0, 0xd1, 0xef, 0x0c, 0x5c,
+	0xdc, 0x61, 0x9a, 0x46, 0x77, 0x86, 0x49, 0x8e, 0x58, 0x2f,
+	0xdf, 0x5f, 0x5d, 0x63, 0xfa, 0x8a, 0x9b, 0x94, 0x58, 0xad,
+	0x35, 0x17, 0x92, 0xab, 0x8d, 0xa6, 0xe1, 0x4d, 0xb7, 0xde,
+	0xf4, 0x87, 0xa7, 0xc1, 0x04, 0x02, 0x32, 0xb8, 0x1a, 0x35,
+	0xa1, 0xb2, 0xd6, 0xd7, 0xd0, 0xde, 0x6f, 0xba, 0x44, 0x70,
+	0x77, 0xa4, 0x44, 0x8f, 0x19, 0x34, 0x26, 0xb9, 0xa4, 0xa3,
+	0xe9, 0xed, 0x48, 0x73, 0x8d, 0x08, 0x00, 0x0b, 0xc8, 0x35,
+	0x56, 0x6f, 0x3a, 0xdb, 0x06, 0x75, 0x99, 0xd3, 0x8c, 0x24,
+	0xf1, 0x3d, 0x4b, 0x16, 0x24, 0xc6, 0xac, 0x5b, 0xcc, 0xa6,
+	0x78, 0xb1, 0xc4, 0x99, 0x72, 0x9b, 0xde, 0x9f, 0xd2, 0x1a,
+	0x39, 0x8c, 0xc5, 0xc7, 0xc6, 0x64, 0x14, 0x04, 0xa4, 0xdf,
+	0xce, 0xcb, 0x31, 0xbd, 0x07, 0xf8, 0x48, 0x8b, 0x88, 0x01,
+	0x30, 0x38, 0x69, 0x65, 0xab, 0x66, 0xaf, 0x6c, 0x3d, 0x90,
+	0xa9, 0xe0, 0x03, 0x3a, 0x80, 0xf7, 0xba, 0x8a, 0x18, 0x82,
+	0x45, 0x2c, 0xf4, 0x31, 0x6a, 0x9c, 0xad, 0x8e, 0x9f, 0x93,
+	0xa3, 0xcb, 0x80, 0xfc, 0x9b, 0xcf, 0xc8, 0x04, 0xb2, 0x89,
+	0x94, 0xa9, 0x77, 0x13, 0x9a, 0xce, 0x68, 0xb1, 0x81, 0x2c,
+	0xf8, 0x4c, 0x90, 0x88, 0x3d, 0xc4, 0x21, 0x33, 0x5b, 0x0b,
+	0xfa, 0x8f, 0x2e, 0x89, 0xbc, 0x2d, 0x01, 0x25, 0x33, 0xbe,
+	0x04, 0xfa, 0xa1, 0xd4, 0x80, 0x48, 0x45, 0x4e, 0xec, 0xed,
+	0x09, 0x78, 0x96, 0xf1, 0x04, 0x47, 0xc3, 0x02, 0x3c, 0x8a,
+	0xc0, 0x36, 0x27, 0xec, 0xc9, 0xc0, 0x95, 0x87, 0x6a, 0x8c,
+	0x6c, 0x90, 0x47, 0x84, 0x14, 0x01, 0x67, 0x97, 0x04, 0xaa,
+	0x78, 0x60, 0x44, 0x16, 0xdc, 0x81, 0x12, 0x48, 0x9e, 0x6b,
+	0x57, 0x53, 0x70, 0xdc, 0xab, 0x8d, 0xa9, 0x1a, 0xe7, 0x00,
+	0x4f, 0x10, 0x2a, 0x4b, 0x43, 0x3e, 0x43, 0x99, 0xc1, 0x41,
+	0x86, 0xc5, 0xaf, 0xb0, 0xc9, 0x2a, 0xc4, 0xb2, 0x86, 0x4f,
+	0xd3, 0x62, 0xaf, 0x3e, 0xbd, 0x5d, 0xae, 0x9b, 0x57, 0xe4,
+	0x62, 0xd1, 0x80, 0x39, 0x1a, 0x1c, 0xaa, 0x3a, 0x98, 0xdb,
+	0x2f, 0x57, 0xef, 0x2f, 0x02, 0x39, 0xc6, 0x53, 0xad, 0xac,
+	0x86, 0xa1, 0x53, 0x43, 0x43, 0x49, 0xab, 0x40, 0xa3, 0xae,
+	0xb7, 0x57, 0x9b, 0x77, 0x17, 0x7c, 0x4e, 0x7e, 0x47, 0x32,
+	0x51, 0x30, 0xfb, 0x83, 0x43, 0xcd, 0x9b, 0xfd, 0xfe, 0xe0,
+	0xd0, 0xea, 0x2d, 0xca, 0x6d, 0x20, 0xef, 0x38, 0x19, 0xbd,
+	0x38, 0xbb, 0x7c, 0x45, 0xf6, 0x29, 0x19, 0x0b, 0x36, 0x3c,
+	0xf0, 0xc6, 0x10, 0x51, 0x5f, 0xf5, 0xfb, 0xcf, 0x1e, 0x25,
+	0x4a, 0x20, 0xdc, 0xdb, 0x78, 0xba, 0xc4, 0x96, 0xa2, 0xfb,
+	0x7d, 0xbf, 0x4f, 0x0f, 0x41, 0xc6, 0xde, 0x95, 0xab, 0xa9,
+	0xda, 0x8a, 0x2a, 0x97, 0x6c, 0xd6, 0x8b, 0xb9, 0x55, 0xd4,
+	0x32, 0xea, 0x5a, 0xe3, 0x54, 0xa5, 0xb0, 0xa6, 0xc8, 0xde,
+	0xfd, 0x29, 0xae, 0xfb, 0x58, 0x57, 0x2b, 0x15, 0xd3, 0x5c,
+	0x09, 0x92, 0x9a, 0xf8, 0x41, 0x5e, 0x1f, 0xba, 0x2c, 0x5f,
+	0xb2, 0xaa, 0xa0, 0x57, 0x55, 0xca, 0x90, 0xa2, 0x15, 0xf9,
+	0xf5, 0x81, 0x87, 0xa9, 0xae, 0xfb, 0x47, 0x69, 0x24, 0x78,
+	0x1c, 0x7d, 0x9e, 0xb3, 0xc1, 0xfb, 0xab, 0xcf, 0xf1, 0xe5,
+	0x18, 0x42, 0x30, 0xfc, 0x43, 0x23, 0xf8, 0xc5, 0xa3, 0xcf,
+	0xc7, 0x09, 0x0d, 0xef, 0x8f, 0x81, 0xa6, 0xc5, 0xe7, 0xb3,
+	0xd3, 0x73, 0x3e, 0x88, 0x13, 0xf6, 0xf9, 0xfd, 0x94, 0x09,
+	0x4a, 0xce, 0xe3, 0x34, 0xb6, 0x83, 0x9f, 0xfa, 0x05, 0xb9,
+	0xee, 0x76, 0x42, 0xf7, 0x4a, 0x9c, 0x50, 0x96, 0x08, 0xa0,
+	0xe0, 0xb5, 0xb5, 0x61, 0x30, 0x3b, 0x28, 0x47, 0xa4, 0x29,
+	0xa3, 0xb5, 0x6a, 0xaf, 0x70, 0x76, 0xe9, 0x76, 0x1a, 0xc0,
+	0xf7, 0xa1, 0xd7, 0xfa, 0xfa, 0x0b, 0x09, 0xcf, 0x53, 0xc2,
+	0x9b, 0x8f, 0x81, 0x6c, 0x8c, 0x01, 0x19, 0xca, 0x0f, 0x6d,
+	0xe1, 0x15, 0xf1, 0xc8, 0x73, 0x02, 0x99, 0x85, 0x77, 0x94,
+	0xaa, 0xbc, 0x0a, 0x12, 0xd8, 0x8c, 0xf0, 0x10, 0xc2, 0x8a,
+	0x60, 0xad, 0xc2, 0x59, 0x35, 0x91, 0xb5, 0x19, 0xc0, 0x8f,
+	0xbb, 0x6e, 0x0a, 0x50, 0xbe, 0x9b, 0x27, 0x2f, 0xed, 0x3d,
+	0x36, 0x95, 0xf4, 0x98, 0xa4, 0x31, 0x51, 0xe4, 0xb4, 0x8d,
+	0xa9, 0xca, 0x88, 0xe5, 0x2d, 0x79, 0x0a, 0x00, 0xae, 0x64,
+	0x29, 0x8a, 0xeb, 0x01, 0x80, 0xaf, 0xae, 0xdb, 0x3a, 0xec,
+	0x6d, 0x1f, 0xf5, 0xd4, 0x6d, 0x37, 0x64, 0xa9, 0x1b, 0xe4,
+	0xec, 0x0d, 0x39, 0x6c, 0xae, 0x8b, 0xe2, 0x56, 0xdc, 0x97,
+	0x72, 0xcb, 0x5a, 0xdc, 0xda, 0xbb, 0xa2, 0xac, 0x91, 0xde,
+	0x57, 0xdb, 0x89, 0xba, 0x79, 0xce, 0x8e, 0x68, 0x14, 0xdf,
+	0x2a, 0xf8, 0x94, 0x52, 0xcd, 0x35, 0xd9, 0xe3, 0x6a, 0xd6,
+	0x3f, 0x51, 0x04, 0xab, 0x45, 0xa1, 0x1c, 0xfa, 0x5f, 0x17,
+	0xc6, 0x66, 0x76, 0xb8, 0x85, 0x70, 0x24, 0x62, 0xaf, 0xb6,
+	0xb7, 0xc4, 0x06, 0x57, 0xd9, 0x68, 0xa0, 0xb2, 0xf7, 0xdc,
+	0x5a, 0x55, 0xb9, 0x3f, 0x95, 0x2a, 0xb3, 0xc9, 0x18, 0x4b,
+	0x27, 0xf5, 0x5e, 0x2a, 0x13, 0x5f, 0x03, 0x47, 0xb1, 0x60,
+	0x80, 0x03, 0x3a, 0xd1, 0x08, 0x08, 0x23, 0x44, 0x0b, 0x4a,
+	0x18, 0xbd, 0x7f, 0xcf, 0x78, 0x2a, 0x6d, 0xb6, 0x1e, 0xc2,
+	0x95, 0x29, 0xef, 0xad, 0xdb, 0xab, 0x83, 0x79, 0x7d, 0x77,
+	0xa9, 0x6e, 0xa9, 0xfe, 0xd4, 0x07, 0x60, 0x0e, 0xb4, 0x1b,
+	0x2f, 0x86, 0x27, 0xde, 0xc7, 0x75, 0x9b, 0x4b, 0x57, 0x79,
+	0x2d, 0x25, 0x37, 0x9e, 0xe9, 0x39, 0x37, 0x43, 0x58, 0x13,
+	0xf3, 0xb6, 0xf7, 0xf4, 0x4f, 0x72, 0xf4, 0xa5, 0xaf, 0xdd,
+	0x86, 0x8b, 0x94, 0x3d, 0xf2, 0xd2, 0xb8, 0x79, 0xed, 0xe8,
+	0xfb, 0xdf, 0x92, 0x73, 0x7a, 0xcf, 0x8a, 0x5c, 0x93, 0x63,
+	0x00, 0x7c, 0x80, 0x84, 0xf5, 0xdb, 0x7e, 0x2d, 0x08, 0xdc,
+	0xf2, 0x24, 0xf2, 0xc1, 0x11, 0x97, 0xea, 0xc0, 0x76, 0xfd,
+	0x2b, 0x0a, 0x28, 0x4c, 0x8c, 0xda, 0x1b, 0x0f, 0xa5, 0xfe,
+	0xc4, 0xa6, 0xdd, 0x85, 0x2f, 0xea, 0xbf, 0x9b, 0xd8, 0x83,
+	0x4f, 0x10, 0xef, 0x80, 0xa7, 0x82, 0xd1, 0x68, 0x21, 0xe7,
+	0x01, 0x38, 0xb6, 0x1e, 0xb1, 0x52, 0xa3, 0x80, 0x54, 0xee,
+	0x63, 0xc9, 0x3d, 0x72, 0xc7, 0x95, 0x99, 0x20, 0x7c, 0xdf,
+	0x6d, 0x75, 0xc2, 0x76, 0x47, 0x91, 0xc0, 0x7e, 0x07, 0x18,
+	0x94, 0x17, 0x3d, 0xfe, 0x1d, 0x0e, 0xa2, 0xc9, 0x3f, 0x90,
+	0x56, 0x07, 0xb1, 0x51, 0x07, 0xe4, 0x6f, 0xf2, 0x27, 0xf5,
+	0x6a, 0x40, 0xf3, 0x58, 0x55, 0x8d, 0xd7, 0xec, 0x53, 0xbe,
+	0xb9, 0x4b, 0xd0, 0x43, 0xe9, 0xed, 0x7d, 0x81, 0x9e, 0x87,
+	0xff, 0x1f, 0xb8, 0x81, 0x15, 0x19, 0x9f, 0x6c, 0x9b, 0xa2,
+	0x27, 0x15, 0x50, 0x53, 0xc7, 0x0f, 0x2c, 0x92, 0xd3, 0xcb,
+	0xba, 0xa3, 0xd8, 0x2b, 0xa0, 0x28, 0x1b, 0xc0, 0x9e, 0x60,
+	0x07, 0xd2, 0xb9, 0x4e, 0x8f, 0x74, 0x74, 0x3e, 0xd7, 0xd1,
+	0xe3, 0x9b, 0x3d, 0x67, 0x9d, 0xec, 0x6d, 0x99, 0xbe, 0x57,
+	0xb5, 0x67, 0x59, 0xf2, 0x16, 0x38, 0xce, 0xcc, 0x72, 0x3e,
+	0xbd, 0x14, 0x1c, 0xf4, 0x51, 0x4e, 0x76, 0xd7, 0x5d, 0x55,
+	0x88, 0xa3, 0x55, 0xf3, 0x17, 0x3b, 0x61, 0xc0, 0xbf, 0xdd,
+	0xe0, 0xc3, 0x2a, 0x70, 0x75, 0x71, 0x77, 0x96, 0x46, 0x6c,
+	0x18, 0xa7, 0xc0, 0x3b, 0xbc, 0xc1, 0xdb, 0x72, 0xfe, 0x2a,
+	0x1c, 0xee, 0x9e, 0x3d, 0x42, 0x09, 0x65, 0x45, 0x77, 0xd7,
+	0x0d, 0xf4, 0xb5, 0x25, 0xd7, 0x27, 0xb0, 0x87, 0xca, 0x80,
+	0x53, 0xe6, 0x62, 0xf8, 0x30, 0xa8, 0x1c, 0xe9, 0x37, 0x79,
+	0xe9, 0xda, 0x1c, 0xb8, 0x64, 0x4e, 0x71, 0xf4, 0x24, 0x3e,
+	0x99, 0x41, 0x58, 0x93, 0x50, 0x5a, 0x5a, 0x79, 0x8d, 0x19,
+	0xbf, 0xbb, 0x54, 0xf9, 0x13, 0xab, 0x86, 0xad, 0xfd, 0x35,
+	0x77, 0x8f, 0xb9, 0x6e, 0x93, 0x36, 0xdc, 0x38, 0xd9, 0xa6,
+	0x4b, 0xd8, 0x48, 0x87, 0xf4, 0x53, 0xb7, 0xb2, 0x8e, 0x73,
+	0xe8, 0x20, 0x8d, 0x84, 0xa8, 0xb5, 0x50, 0x70, 0x0c, 0x63,
+	0x31, 0xf1, 0x0a, 0x5d, 0x5e, 0x36, 0x80, 0xad, 0xcc, 0x79,
+	0x5b, 0xe0, 0xe1, 0x94, 0x58, 0xae, 0xd4, 0xae, 0x6e, 0x25,
+	0xcc, 0x5a, 0x2d, 0x3a, 0xc9, 0x46, 0xd8, 0x0b, 0xcf, 0x13,
+	0x66, 0xe0, 0xf7, 0xfb, 0xe4, 0x04, 0x45, 0x2f, 0xef, 0x0a,
+	0xcb, 0xcb, 0x72, 0xc4, 0xac, 0xce, 0x1a, 0xc7, 0x0c, 0x4d,
+	0x09, 0x60, 0x65, 0xc9, 0x0a, 0xf1, 0x6d, 0xe2, 0xb5, 0x2b,
+	0x6b, 0xca, 0x3c, 0x6c, 0x5d, 0x54, 0x65, 0x4c, 0x77, 0x6f,
+	0x83, 0x81, 0xb8, 0x61, 0x10, 0xf0, 0xa5, 0xa2, 0x27, 0xf0,
+	0x64, 0x6f, 0xc3, 0xcd, 0x92, 0x9f, 0x95, 0xed, 0xf2, 0x59,
+	0xe3, 0x80, 0xda, 0xec, 0x72, 0xd0, 0x6c, 0x90, 0x5c, 0xc5,
+	0x79, 0xff, 0xaf, 0xc9, 0xad, 0x81, 0x88, 0x2f, 0x2d, 0xb9,
+	0x95, 0xac, 0x57, 0xec, 0x79, 0x92, 0xd4, 0xd4, 0xd6, 0xed,
+	0x64, 0x56, 0x53, 0xd3, 0xaa, 0xef, 0xb4, 0x74, 0x8e, 0x7c,
+	0x77, 0x14, 0xb6, 0x3a, 0x25, 0x2d, 0x07, 0x3e, 0xd5, 0xc7,
+	0x20, 0x1e, 0x64, 0x1c, 0xa6, 0x95, 0xd1, 0x14, 0xfa, 0x72,
+	0x0d, 0xe1, 0x2d, 0x43, 0xf9, 0xc8, 0xfb, 0x2b, 0x39, 0xd0,
+	0xb6, 0x83, 0x01, 0xc9, 0xeb, 0x79, 0xce, 0x1f, 0x56, 0xf6,
+	0x3f, 0xed, 0xcc, 0xe7, 0xf3, 0x9d, 0x21, 0x17, 0x93, 0x9d,
+	0x99, 0x48, 0xb0, 0xa1, 0x1a, 0x39, 0xf1, 0xbc, 0x1e, 0x4a,
+	0x0b, 0xbc, 0x8b, 0x7e, 0xfb, 0x93, 0xb3, 0x64, 0xa7, 0x0d,
+	0x2c, 0x29, 0xaa, 0xb6, 0xf4, 0x4d, 0x2d, 0x80, 0xdd, 0x78,
+	0xdb, 0x58, 0xdf, 0xa8, 0xa3, 0xaf, 0xb2, 0x6d, 0xf5, 0x19,
+	0x57, 0xb8, 0x8d, 0x74, 0xb3, 0x72, 0x40, 0xb1, 0xe9, 0xc8,
+	0x9d, 0xe6, 0x3d, 0xb6, 0xe4, 0x37, 0x6f, 0x9e, 0xcb, 0x04,
+	0xfe, 0xd7, 0x7a, 0x6b, 0xdc, 0xe6, 0xf0, 0x3f, 0xec, 0x16,
+	0x49, 0xac, 0x4e, 0xe0, 0x6b, 0xb3, 0x44, 0xd2, 0x36, 0xde,
+	0xab, 0xb1, 0xb7, 0x34, 0xe1, 0x73, 0xba, 0x53, 0x8d, 0x29,
+	0x68, 0x39, 0xf7, 0xaa, 0xf7, 0xb7, 0x9f, 0x98, 0xcd, 0x6e,
+	0xd9, 0xe4, 0x6e, 0x69, 0x70, 0x97, 0x1b, 0xce, 0x48, 0x34,
+	0x53, 0x53, 0x88, 0x61, 0x42, 0xb3, 0x31, 0x99, 0xb0, 0x09,
+	0xc7, 0x52, 0x29, 0x8d, 0x8c, 0x56, 0x70, 0xec, 0xee, 0xa3,
+	0x70, 0x4c, 0x97, 0x54, 0xf1, 0x06, 0xa5, 0x6a, 0x84, 0xea,
+	0x0a, 0xf3, 0xe8, 0xf2, 0x4b, 0xf6, 0xc7, 0x89, 0x69, 0x90,
+	0x37, 0x4d, 0x16, 0xb6, 0xeb, 0xaf, 0xbd, 0x96, 0x7f, 0xbe,
+	0x2a, 0x87, 0x35, 0x48, 0x75, 0x8d, 0xe6, 0x36, 0xed, 0x93,
+	0xf7, 0x02, 0xb0, 0x52, 0x90, 0x2a, 0xb7, 0x7d, 0x1f, 0xae,
+	0xbd, 0x18, 0xf8, 0xd2, 0x45, 0x40, 0x53, 0x0e, 0x29, 0x3d,
+	0xe1, 0x7f, 0x01, 0xab, 0xc6, 0x4f, 0xd9, 0x7e, 0x3e, 0x00,
+	0x00
+};
+
 const HTTPSRV_FS_DIR_ENTRY httpsrv_fs_data[] = {
-	{ "/favicon.ico", 0, (unsigned char*)httpsrv_fs_webui_favicon_ico, sizeof(httpsrv_fs_webui_favicon_ico) },
-	{ "/index.html", 0, (unsigned char*)httpsrv_fs_webui_index_html, sizeof(httpsrv_fs_webui_index_html) },
-	{ "/NXP_logo.png", 0, (unsigned char*)httpsrv_fs_webui_NXP_logo_png, sizeof(httpsrv_fs_webui_NXP_logo_png) },
-	{ "/webconfig.css", 0, (unsigned char*)httpsrv_fs_webui_webconfig_css, sizeof(httpsrv_fs_webui_webconfig_css) },
-	{ "/webconfig.js", 0, (unsigned char*)httpsrv_fs_webui_webconfig_js, sizeof(httpsrv_fs_webui_webconfig_js) },
-	{ 0, 0, 0, 0 }
+	{ "/favicon.ico", 8, (unsigned char*)httpsrv_fs_webui_favicon_ico, sizeof(httpsrv_fs_webui_favicon_ico), "\"962033a0fd0b8eb7\"" },
+	{ "/favicon.ico.gz", 4, (unsigned char*)httpsrv_fs_webui_favicon_ico_gz, sizeof(httpsrv_fs_webui_favicon_ico_gz), "\"82c626798497b477\"" },
+	{ "/index.html", 8, (unsigned char*)httpsrv_fs_webui_index_html, sizeof(httpsrv_fs_webui_index_html), "\"3877ae713b3c90c0\"" },
+	{ "/index.html.gz", 4, (unsigned char*)httpsrv_fs_webui_index_html_gz, sizeof(httpsrv_fs_webui_index_html_gz), "\"afc75fc043f23818\"" },
+	{ "/NXP_logo.png", 0, (unsigned char*)httpsrv_fs_webui_NXP_logo_png, sizeof(httpsrv_fs_webui_NXP_logo_png), "\"5cfc281458510b2b\"" },
+	{ "/webconfig.css", 8, (unsigned char*)httpsrv_fs_webui_webconfig_css, sizeof(httpsrv_fs_webui_webconfig_css), "\"7c90d82aaf3f9b8c\"" },
+	{ "/webconfig.css.gz", 4, (unsigned char*)httpsrv_fs_webui_webconfig_css_gz, sizeof(httpsrv_fs_webui_webconfig_css_gz), "\"8ca95af5b43f49fa\"" },
+	{ "/webconfig.js", 8, (unsigned char*)httpsrv_fs_webui_webconfig_js, sizeof(httpsrv_fs_webui_webconfig_js), "\"abe99fb0ece831e1\"" },
+	{ "/webconfig.js.gz", 4, (unsigned char*)httpsrv_fs_webui_webconfig_js_gz, sizeof(httpsrv_fs_webui_webconfig_js_gz), "\"b362b9c51561fb2e\"" },
+	{ 0, 0, 0, 0, 0 }
 };
 
+static const HTTPSRV_FS_INDEX_SLOT httpsrv_fs_index_slots[32] = {
+	{ 0, 0, 0 },
+	{ 0, 0, 0 },
+	{ 0, 0, 0 },
+	{ 0, 0, 0 },
+	{ 0, 0, 0 },
+	{ 0, 0, 0 },
+	{ 0, 0, 0 },
+	{ 0, 0, 0 },
+	{ 0, 0, 0 },
+	{ 0, 0, 0 },
+	{ 0, 0, 0 },
+	{ 0, 0, 0 },
+	{ 0x6e53670c, "/INDEX.HTML.GZ", 4 },
+	{ 0, 0, 0 },
+	{ 0, 0, 0 },
+	{ 0x2c9092af, "/WEBCONFIG.CSS", 6 },
+	{ 0x71d22f50, "/FAVICON.ICO.GZ", 2 },
+	{ 0xd7c6b7d1, "/INDEX.HTML", 3 },
+	{ 0xd3527592, "/WEBCONFIG.CSS.GZ", 7 },
+	{ 0x480df6af, "/WEBCONFIG.JS", 8 },
+	{ 0x65fac192, "/WEBCONFIG.JS.GZ", 9 },
+	{ 0, 0, 0 },
+	{ 0, 0, 0 },
+	{ 0, 0, 0 },
+	{ 0, 0, 0 },
+	{ 0, 0, 0 },
+	{ 0, 0, 0 },
+	{ 0xbc9463fb, "/NXP_LOGO.PNG", 5 },
+	{ 0, 0, 0 },
+	{ 0xc66974fd, "/FAVICON.ICO", 1 },
+	{ 0, 0, 0 },
+	{ 0, 0, 0 },
+};
+
+const HTTPSRV_FS_INDEX httpsrv_fs_index = { httpsrv_fs_data, httpsrv_fs_index_slots, 31 };
+
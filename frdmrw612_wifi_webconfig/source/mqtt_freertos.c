@@ -11,12 +11,14 @@
  * Includes
  ******************************************************************************/
 #include "mqtt_freertos.h"
+#include "mqtt_router.h"
 
 #include "board.h"
 #include "fsl_silicon_id.h"
 #include "lwip/dns.h"
 #include "lwip/opt.h"
 #include "lwip/api.h"
+#include "lwip/memp.h"
 #include "lwip/apps/mqtt.h"
 #include "lwip/tcpip.h"
 
@@ -48,12 +50,91 @@
 /*! @brief Priority of the temporary initialization thread. */
 #define APP_THREAD_PRIO DEFAULT_THREAD_PRIO
 
+/*! @brief Number of messages that can wait in the publish queue. */
+#ifndef EXAMPLE_MQTT_PUB_QUEUE_LEN
+#define EXAMPLE_MQTT_PUB_QUEUE_LEN 16
+#endif
+
+/*! @brief Maximum topic length (including terminator) of a queued message. */
+#ifndef EXAMPLE_MQTT_PUB_TOPIC_MAX
+#define EXAMPLE_MQTT_PUB_TOPIC_MAX 64
+#endif
+
+/*! @brief Maximum payload size of a queued message. */
+#ifndef EXAMPLE_MQTT_PUB_PAYLOAD_MAX
+#define EXAMPLE_MQTT_PUB_PAYLOAD_MAX 128
+#endif
+
+/*!
+ * @brief Maximum number of publish requests handed to the MQTT client and not completed yet.
+ *
+ * QoS 0 requests complete once sent, QoS 1/2 once acknowledged by the broker. Two request slots
+ * of the client are left for subscriptions.
+ */
+#ifndef EXAMPLE_MQTT_PUB_WINDOW
+#define EXAMPLE_MQTT_PUB_WINDOW (MQTT_REQ_MAX_IN_FLIGHT - 2)
+#endif
+
+/*!
+ * @brief Period of the publish queue poll while connected, in ms.
+ *
+ * Picks up messages which could not be handed to the MQTT client right away, e.g. when its output
+ * buffer was full with nothing in flight or when tcpip_thread mailbox was full.
+ */
+#ifndef EXAMPLE_MQTT_PUB_POLL_MS
+#define EXAMPLE_MQTT_PUB_POLL_MS 100
+#endif
+
+#if (EXAMPLE_MQTT_PUB_WINDOW < 1) || (EXAMPLE_MQTT_PUB_WINDOW > (MQTT_REQ_MAX_IN_FLIGHT - 2))
+#error "EXAMPLE_MQTT_PUB_WINDOW must be between 1 and MQTT_REQ_MAX_IN_FLIGHT - 2"
+#endif
+
+/*******************************************************************************
+ * Types
+ ******************************************************************************/
+
+/*! @brief Message waiting in the publish queue. */
+typedef struct _mqtt_pub_msg
+{
+    u32_t enqueue_time;
+    u16_t len;
+    u8_t qos;
+    u8_t retain;
+    char topic[EXAMPLE_MQTT_PUB_TOPIC_MAX];
+    u8_t payload[EXAMPLE_MQTT_PUB_PAYLOAD_MAX];
+} mqtt_pub_msg_t;
+
+/*! @brief Publish request handed to the MQTT client and not completed yet. */
+typedef struct _mqtt_pub_inflight
+{
+    u32_t enqueue_time;
+    u16_t len;
+    bool used;
+} mqtt_pub_inflight_t;
+
+/*! @brief Publish queue statistics. */
+typedef struct _mqtt_pub_stats
+{
+    u32_t start_time;
+    u32_t published;
+    u32_t bytes;
+    u32_t failed;
+    u32_t dropped;
+    u32_t latency_sum;
+    u32_t latency_min;
+    u32_t latency_max;
+} mqtt_pub_stats_t;
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
 
 static void connect_to_mqtt(void *ctx);
 static void disconnect_from_mqtt(void *ctx);
+static void mqtt_pub_process(void);
+static void mqtt_pub_schedule_drain(void);
+static void mqtt_pub_poll(void *ctx);
+static void mqtt_pub_inflight_abort(void);
 
 /*******************************************************************************
  * Variables
@@ -86,6 +167,27 @@ static ip_addr_t mqtt_addr;
 /*! @brief Indicates connection to MQTT broker. */
 static volatile bool connected = false;
 
+/*! @brief Storage of queued messages. */
+LWIP_MEMPOOL_DECLARE(MQTT_PUB_POOL, EXAMPLE_MQTT_PUB_QUEUE_LEN, sizeof(mqtt_pub_msg_t), "MQTT publish queue");
+
+/*! @brief Queued messages in publish order. */
+static sys_mbox_t pub_mbox;
+
+/*! @brief Message taken from the queue which did not fit into the window or output buffer yet. */
+static mqtt_pub_msg_t *pub_pending;
+
+/*! @brief Publish requests waiting for completion. */
+static mqtt_pub_inflight_t pub_inflight[EXAMPLE_MQTT_PUB_WINDOW];
+
+/*! @brief Number of entries used in pub_inflight. */
+static u16_t pub_inflight_cnt;
+
+/*! @brief Indicates mqtt_pub_drain() is already queued on tcpip_thread. */
+static volatile bool pub_drain_scheduled;
+
+/*! @brief Publish queue statistics. */
+static mqtt_pub_stats_t pub_stats;
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
@@ -108,7 +210,7 @@ static void mqtt_topic_subscribed_cb(void *arg, err_t err)
 }
 
 /*!
- * @brief Called when there is a message on a subscribed topic.
+ * @brief Called when there is a message on a subscribed topic, arg is the matching subscription.
  */
 static void mqtt_incoming_publish_cb(void *arg, const char *topic, u32_t tot_len)
 {
@@ -154,11 +256,18 @@ static void mqtt_subscribe_topics(mqtt_client_t *client)
     err_t err;
     int i;
 
-    mqtt_set_inpub_callback(client, mqtt_incoming_publish_cb, mqtt_incoming_data_cb,
-                            LWIP_CONST_CAST(void *, &mqtt_client_info));
+    mqtt_router_init(client, NULL, NULL, NULL);
 
     for (i = 0; i < ARRAY_SIZE(topics); i++)
     {
+        err = mqtt_router_add(topics[i], mqtt_incoming_publish_cb, mqtt_incoming_data_cb,
+                              LWIP_CONST_CAST(void *, topics[i]));
+        if (err != ERR_OK)
+        {
+            PRINTF("Failed to add route for the topic \"%s\": %d.\r\n", topics[i], err);
+            continue;
+        }
+
         err = mqtt_subscribe(client, topics[i], qos[i], mqtt_topic_subscribed_cb, LWIP_CONST_CAST(void *, topics[i]));
 
         if (err == ERR_OK)
@@ -181,11 +290,21 @@ static void mqtt_connection_cb(mqtt_client_t *client, void *arg, mqtt_connection
 
     connected = (status == MQTT_CONNECT_ACCEPTED);
 
+    if (!connected)
+    {
+        sys_untimeout(mqtt_pub_poll, NULL);
+        mqtt_pub_inflight_abort();
+    }
+
     switch (status)
     {
         case MQTT_CONNECT_ACCEPTED:
             PRINTF("MQTT client \"%s\" connected.\r\n", client_info->client_id);
             mqtt_subscribe_topics(client);
+            /* Send out whatever was queued while disconnected */
+            mqtt_pub_process();
+            sys_untimeout(mqtt_pub_poll, NULL);
+            sys_timeout(EXAMPLE_MQTT_PUB_POLL_MS, mqtt_pub_poll, NULL);
             break;
 
         case MQTT_CONNECT_DISCONNECTED:
@@ -240,39 +359,261 @@ static void disconnect_from_mqtt(void *ctx)
 
     mqtt_disconnect(mqtt_client);
     connected = false;
+    sys_untimeout(mqtt_pub_poll, NULL);
+    mqtt_pub_inflight_abort();
     PRINTF("Disconnected from MQTT broker.\r\n");
 }
 
+/*!
+ * @brief Returns a free in-flight entry or NULL when the window is full. To be called on tcpip_thread.
+ */
+static mqtt_pub_inflight_t *mqtt_pub_inflight_alloc(void)
+{
+    int i;
+
+    for (i = 0; i < EXAMPLE_MQTT_PUB_WINDOW; i++)
+    {
+        if (!pub_inflight[i].used)
+        {
+            pub_inflight[i].used = true;
+            pub_inflight_cnt++;
+            return &pub_inflight[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*!
+ * @brief Releases an in-flight entry. To be called on tcpip_thread.
+ */
+static void mqtt_pub_inflight_free(mqtt_pub_inflight_t *inflight)
+{
+    inflight->used = false;
+    pub_inflight_cnt--;
+}
+
+/*!
+ * @brief Releases all in-flight entries. The MQTT client drops its pending requests without calling
+ * their callbacks when the connection closes. To be called on tcpip_thread.
+ */
+static void mqtt_pub_inflight_abort(void)
+{
+    int i;
+
+    for (i = 0; i < EXAMPLE_MQTT_PUB_WINDOW; i++)
+    {
+        if (pub_inflight[i].used)
+        {
+            pub_stats.failed++;
+            pub_inflight[i].used = false;
+        }
+    }
+
+    pub_inflight_cnt = 0;
+}
+
 /*!
  * @brief Called when publish request finishes.
  */
 static void mqtt_message_published_cb(void *arg, err_t err)
 {
-    const char *topic = (const char *)arg;
+    mqtt_pub_inflight_t *inflight = (mqtt_pub_inflight_t *)arg;
+    u32_t latency                 = sys_now() - inflight->enqueue_time;
 
     if (err == ERR_OK)
     {
-        PRINTF("Published to the topic \"%s\".\r\n", topic);
+        pub_stats.published++;
+        pub_stats.bytes += inflight->len;
+        pub_stats.latency_sum += latency;
+        pub_stats.latency_min = LWIP_MIN(pub_stats.latency_min, latency);
+        pub_stats.latency_max = LWIP_MAX(pub_stats.latency_max, latency);
     }
     else
     {
-        PRINTF("Failed to publish to the topic \"%s\": %d.\r\n", topic, err);
+        pub_stats.failed++;
     }
+
+    mqtt_pub_inflight_free(inflight);
+
+    /*
+     * A slot in the window is free now. The queue is not processed from here, the MQTT client completes
+     * all pending QoS 0 requests in a loop and would complete new ones before they are sent.
+     */
+    mqtt_pub_schedule_drain();
 }
 
 /*!
- * @brief Publishes a message. To be called on tcpip_thread.
+ * @brief Hands queued messages to the MQTT client while the window and its output buffer allow.
+ * To be called on tcpip_thread.
  */
-static void publish_message(void *ctx)
+static void mqtt_pub_process(void)
 {
-    static const char *topic   = "lwip_topic/100";
-    static const char *message = "message from board";
+    mqtt_pub_inflight_t *inflight;
+    err_t err;
+
+    while (connected)
+    {
+        if ((pub_pending == NULL) && (sys_arch_mbox_tryfetch(&pub_mbox, (void **)&pub_pending) == SYS_MBOX_EMPTY))
+        {
+            /* Queue is empty */
+            break;
+        }
 
+        inflight = mqtt_pub_inflight_alloc();
+        if (inflight == NULL)
+        {
+            /* Window is full, continued once mqtt_message_published_cb() frees a slot */
+            break;
+        }
+
+        inflight->enqueue_time = pub_pending->enqueue_time;
+        inflight->len          = pub_pending->len;
+
+        err = mqtt_publish(mqtt_client, pub_pending->topic, pub_pending->payload, pub_pending->len, pub_pending->qos,
+                           pub_pending->retain, mqtt_message_published_cb, inflight);
+        if (err != ERR_OK)
+        {
+            mqtt_pub_inflight_free(inflight);
+
+            if (err == ERR_MEM)
+            {
+                /* Output buffer is full, retried when a request completes or from mqtt_pub_poll() */
+                break;
+            }
+
+            pub_stats.failed++;
+        }
+
+        LWIP_MEMPOOL_FREE(MQTT_PUB_POOL, pub_pending);
+        pub_pending = NULL;
+    }
+}
+
+/*!
+ * @brief Runs mqtt_pub_process() from a tcpip_thread callback.
+ */
+static void mqtt_pub_drain(void *ctx)
+{
+    LWIP_UNUSED_ARG(ctx);
+
+    /* Cleared first, so messages queued from now on schedule another run */
+    pub_drain_scheduled = false;
+
+    mqtt_pub_process();
+}
+
+/*!
+ * @brief Queues mqtt_pub_drain() on tcpip_thread unless it is queued already. Can be called from any task.
+ */
+static void mqtt_pub_schedule_drain(void)
+{
+    bool schedule;
+    SYS_ARCH_DECL_PROTECT(lev);
+
+    SYS_ARCH_PROTECT(lev);
+    schedule            = !pub_drain_scheduled;
+    pub_drain_scheduled = true;
+    SYS_ARCH_UNPROTECT(lev);
+
+    if (schedule && (tcpip_try_callback(mqtt_pub_drain, NULL) != ERR_OK))
+    {
+        /* tcpip_thread mailbox is full, the queue is processed from mqtt_pub_poll() */
+        pub_drain_scheduled = false;
+    }
+}
+
+/*!
+ * @brief Processes the publish queue periodically while connected. To be called on tcpip_thread.
+ */
+static void mqtt_pub_poll(void *ctx)
+{
+    LWIP_UNUSED_ARG(ctx);
+
+    mqtt_pub_process();
+    sys_timeout(EXAMPLE_MQTT_PUB_POLL_MS, mqtt_pub_poll, NULL);
+}
+
+/*!
+ * @brief Resets publish queue statistics. To be called on tcpip_thread.
+ */
+static void mqtt_pub_stats_reset(void *ctx)
+{
     LWIP_UNUSED_ARG(ctx);
 
-    PRINTF("Going to publish to the topic \"%s\"...\r\n", topic);
+    memset(&pub_stats, 0, sizeof(pub_stats));
+    pub_stats.latency_min = UINT32_MAX;
+    pub_stats.start_time  = sys_now();
+}
+
+/*!
+ * @brief Prints publish queue statistics. To be called on tcpip_thread.
+ */
+static void mqtt_pub_stats_print(void *ctx)
+{
+    u32_t elapsed = sys_now() - pub_stats.start_time;
 
-    mqtt_publish(mqtt_client, topic, message, strlen(message), 1, 0, mqtt_message_published_cb, (void *)topic);
+    LWIP_UNUSED_ARG(ctx);
+
+    PRINTF("Published %u messages (%u bytes) in %u ms, %u failed, %u dropped.\r\n", (unsigned int)pub_stats.published,
+           (unsigned int)pub_stats.bytes, (unsigned int)elapsed, (unsigned int)pub_stats.failed,
+           (unsigned int)pub_stats.dropped);
+
+    if (pub_stats.published > 0U)
+    {
+        PRINTF("Publish latency min/avg/max: %u/%u/%u ms.\r\n", (unsigned int)pub_stats.latency_min,
+               (unsigned int)(pub_stats.latency_sum / pub_stats.published), (unsigned int)pub_stats.latency_max);
+    }
+}
+
+/*!
+ * @brief Queues a message for publishing. Can be called from any task.
+ *
+ * Messages are copied into the queue and published in order from tcpip_thread, keeping up to
+ * EXAMPLE_MQTT_PUB_WINDOW requests in flight. Messages queued while disconnected are sent after
+ * the connection is established.
+ *
+ * @param topic    topic to publish to
+ * @param payload  message payload
+ * @param len      payload length, at most EXAMPLE_MQTT_PUB_PAYLOAD_MAX
+ * @param qos      quality of service, 0, 1 or 2
+ * @param retain   MQTT retain flag
+ * @return ERR_OK when queued, ERR_MEM when the queue is full, ERR_VAL on invalid arguments
+ */
+err_t mqtt_freertos_publish(const char *topic, const void *payload, u16_t len, u8_t qos, u8_t retain)
+{
+    mqtt_pub_msg_t *msg;
+    size_t topic_len = strlen(topic);
+
+    if ((topic_len >= EXAMPLE_MQTT_PUB_TOPIC_MAX) || (len > EXAMPLE_MQTT_PUB_PAYLOAD_MAX) || (qos > 2U))
+    {
+        return ERR_VAL;
+    }
+
+    msg = (mqtt_pub_msg_t *)LWIP_MEMPOOL_ALLOC(MQTT_PUB_POOL);
+    if (msg == NULL)
+    {
+        SYS_ARCH_INC(pub_stats.dropped, 1);
+        return ERR_MEM;
+    }
+
+    msg->enqueue_time = sys_now();
+    msg->len          = len;
+    msg->qos          = qos;
+    msg->retain       = retain;
+    memcpy(msg->topic, topic, topic_len + 1U);
+    memcpy(msg->payload, payload, len);
+
+    if (sys_mbox_trypost(&pub_mbox, msg) != ERR_OK)
+    {
+        LWIP_MEMPOOL_FREE(MQTT_PUB_POOL, msg);
+        SYS_ARCH_INC(pub_stats.dropped, 1);
+        return ERR_MEM;
+    }
+
+    mqtt_pub_schedule_drain();
+
+    return ERR_OK;
 }
 
 /*!
@@ -280,7 +621,9 @@ static void publish_message(void *ctx)
  */
 static void app_thread(void *arg)
 {
-    struct netif *netif = (struct netif *)arg;
+    static const char *topic   = "lwip_topic/100";
+    static const char *message = "message from board";
+    struct netif *netif        = (struct netif *)arg;
     err_t err;
     int i;
 
@@ -328,14 +671,18 @@ static void app_thread(void *arg)
     }
 
     /* Publish some messages */
+    (void)tcpip_callback(mqtt_pub_stats_reset, NULL);
+
     for (i = 0; i < 5;)
     {
         if (connected)
         {
-            err = tcpip_callback(publish_message, NULL);
+            PRINTF("Going to publish to the topic \"%s\"...\r\n", topic);
+
+            err = mqtt_freertos_publish(topic, message, strlen(message), 1, 0);
             if (err != ERR_OK)
             {
-                PRINTF("Failed to invoke publishing of a message on the tcpip_thread: %d.\r\n", err);
+                PRINTF("Failed to queue a message for publishing: %d.\r\n", err);
             }
             i++;
         }
@@ -343,6 +690,8 @@ static void app_thread(void *arg)
         sys_msleep(1000U);
     }
 
+    (void)tcpip_callback(mqtt_pub_stats_print, NULL);
+
     /* Disconnect from MQTT broker from tcpip_thread */
     err = tcpip_callback(disconnect_from_mqtt, NULL);
     if (err != ERR_OK)
@@ -426,6 +775,15 @@ void mqtt_freertos_run_thread(struct netif *netif)
         }
     }
 
+    LWIP_MEMPOOL_INIT(MQTT_PUB_POOL);
+    if (sys_mbox_new(&pub_mbox, EXAMPLE_MQTT_PUB_QUEUE_LEN) != ERR_OK)
+    {
+        PRINTF("Failed to create the publish queue.\r\n");
+        while (1)
+        {
+        }
+    }
+
     generate_client_id();
 
     if (sys_thread_new("app_task", app_thread, netif, APP_THREAD_STACKSIZE, APP_THREAD_PRIO) == NULL)
@@ -0,0 +1,429 @@
+/*
+ * Copyright 2025 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "mqtt_router.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Number of slots of the trie edge hash table, power of two larger than MQTT_ROUTER_NODES_MAX. */
+#ifndef MQTT_ROUTER_HASH_SIZE
+#define MQTT_ROUTER_HASH_SIZE 128
+#endif
+
+#if ((MQTT_ROUTER_HASH_SIZE & (MQTT_ROUTER_HASH_SIZE - 1)) != 0) || (MQTT_ROUTER_HASH_SIZE <= MQTT_ROUTER_NODES_MAX)
+#error "MQTT_ROUTER_HASH_SIZE must be a power of two larger than MQTT_ROUTER_NODES_MAX"
+#endif
+
+#if MQTT_ROUTER_NODES_MAX > 0xFFFF || MQTT_ROUTER_ROUTES_MAX > 0xFFFE || MQTT_ROUTER_LEVELS_SIZE > 0xFFFF
+#error "MQTT router arena sizes must fit 16 bit indexes"
+#endif
+
+/*! @brief Index of the root node, it is never a child so 0 also means "no node". */
+#define MQTT_ROUTER_ROOT 0U
+
+/*******************************************************************************
+ * Types
+ ******************************************************************************/
+
+/*!
+ * @brief Trie node, one per topic filter level.
+ *
+ * Children with plain level text are found through router_hash, keyed by parent index and text.
+ * The '+' and '#' children are linked directly so wildcards cost no lookup.
+ */
+typedef struct _mqtt_router_node
+{
+    u16_t parent;
+    u16_t level;     /* offset of level text in router_levels */
+    u16_t level_len;
+    u16_t route;     /* route index + 1 of filter ending here, 0 if none */
+    u16_t plus;      /* '+' child, 0 if none */
+    u16_t multi;     /* '#' child, 0 if none */
+} mqtt_router_node_t;
+
+/*! @brief Callbacks of a route. */
+typedef struct _mqtt_router_route
+{
+    mqtt_incoming_publish_cb_t pub_cb;
+    mqtt_incoming_data_cb_t data_cb;
+    void *arg;
+} mqtt_router_route_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/*! @brief Trie nodes, router_nodes[MQTT_ROUTER_ROOT] is the root. */
+static mqtt_router_node_t router_nodes[MQTT_ROUTER_NODES_MAX];
+
+/*! @brief Number of entries used in router_nodes. */
+static u16_t router_node_cnt;
+
+/*! @brief Open addressing hash table of plain level nodes, 0 marks a free slot. */
+static u16_t router_hash[MQTT_ROUTER_HASH_SIZE];
+
+/*! @brief Text of plain filter levels, not zero terminated. */
+static char router_levels[MQTT_ROUTER_LEVELS_SIZE];
+
+/*! @brief Number of bytes used in router_levels. */
+static u16_t router_levels_len;
+
+/*! @brief Routes referenced by trie nodes. */
+static mqtt_router_route_t router_routes[MQTT_ROUTER_ROUTES_MAX];
+
+/*! @brief Number of entries used in router_routes. */
+static u16_t router_route_cnt;
+
+/*! @brief Route for messages not matching any filter. */
+static mqtt_router_route_t router_default;
+
+/*! @brief Routes matching the incoming message being received. */
+static const mqtt_router_route_t *router_match[MQTT_ROUTER_MATCH_MAX];
+
+/*! @brief Number of entries used in router_match. */
+static u8_t router_match_cnt;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*!
+ * @brief Returns hash table slot to start looking up a child level of a node at.
+ */
+static u16_t mqtt_router_hash(u16_t parent, const char *level, u16_t len)
+{
+    /* FNV-1a, seeded with the parent */
+    u32_t h = 2166136261UL ^ parent;
+
+    while (len-- > 0U)
+    {
+        h ^= (u8_t)*level++;
+        h *= 16777619UL;
+    }
+
+    return (u16_t)(h & (MQTT_ROUTER_HASH_SIZE - 1U));
+}
+
+/*!
+ * @brief Looks up plain level child of a node.
+ *
+ * @param parent  parent node
+ * @param level   level text, not zero terminated
+ * @param len     level text length
+ * @param slot    receives the free hash table slot for the child when not found, may be NULL
+ * @return child node, 0 when not found
+ */
+static u16_t mqtt_router_find(u16_t parent, const char *level, u16_t len, u16_t *slot)
+{
+    u16_t i = mqtt_router_hash(parent, level, len);
+
+    /* Terminates since the table is larger than the number of nodes */
+    while (router_hash[i] != 0U)
+    {
+        const mqtt_router_node_t *node = &router_nodes[router_hash[i]];
+
+        if ((node->parent == parent) && (node->level_len == len) &&
+            (memcmp(&router_levels[node->level], level, len) == 0))
+        {
+            return router_hash[i];
+        }
+        i = (u16_t)((i + 1U) & (MQTT_ROUTER_HASH_SIZE - 1U));
+    }
+
+    if (slot != NULL)
+    {
+        *slot = i;
+    }
+    return 0;
+}
+
+/*!
+ * @brief Allocates a node from the arena.
+ *
+ * @return new node, 0 when the arena is full
+ */
+static u16_t mqtt_router_node_new(u16_t parent)
+{
+    mqtt_router_node_t *node;
+
+    if (router_node_cnt >= MQTT_ROUTER_NODES_MAX)
+    {
+        return 0;
+    }
+
+    node = &router_nodes[router_node_cnt];
+    memset(node, 0, sizeof(*node));
+    node->parent = parent;
+
+    return router_node_cnt++;
+}
+
+/*!
+ * @brief Returns wildcard child of a node, allocating it if needed.
+ *
+ * @return child node, 0 when the arena is full
+ */
+static u16_t mqtt_router_wildcard_child(u16_t parent, u16_t *link)
+{
+    if (*link == 0U)
+    {
+        *link = mqtt_router_node_new(parent);
+    }
+    return *link;
+}
+
+/*!
+ * @brief Returns plain level child of a node, allocating it if needed.
+ *
+ * @return child node, 0 when the arena is full
+ */
+static u16_t mqtt_router_level_child(u16_t parent, const char *level, u16_t len)
+{
+    u16_t slot;
+    u16_t child = mqtt_router_find(parent, level, len, &slot);
+
+    if (child == 0U)
+    {
+        if (len > (MQTT_ROUTER_LEVELS_SIZE - router_levels_len))
+        {
+            return 0;
+        }
+
+        child = mqtt_router_node_new(parent);
+        if (child == 0U)
+        {
+            return 0;
+        }
+
+        memcpy(&router_levels[router_levels_len], level, len);
+        router_nodes[child].level     = router_levels_len;
+        router_nodes[child].level_len = len;
+        router_levels_len             = (u16_t)(router_levels_len + len);
+        router_hash[slot]             = child;
+    }
+
+    return child;
+}
+
+/*!
+ * @brief Adds route of a node to the routes matching the incoming message.
+ */
+static void mqtt_router_match_add(u16_t node)
+{
+    u16_t route = router_nodes[node].route;
+
+    if (route == 0U)
+    {
+        return;
+    }
+
+    /* Routes beyond MQTT_ROUTER_MATCH_MAX are not served */
+    if (router_match_cnt < MQTT_ROUTER_MATCH_MAX)
+    {
+        router_match[router_match_cnt++] = &router_routes[route - 1U];
+    }
+}
+
+/*!
+ * @brief Collects routes matching the rest of a topic below a node.
+ *
+ * @param node       node matched by the topic levels before level
+ * @param level      remaining topic levels, NULL when the whole topic has been matched
+ * @param wildcards  false if wildcards must not match level, for topics starting with '$'
+ */
+static void mqtt_router_match_topic(u16_t node, const char *level, bool wildcards)
+{
+    const mqtt_router_node_t *n = &router_nodes[node];
+    const char *end;
+    const char *next;
+    u16_t child;
+
+    if (level == NULL)
+    {
+        mqtt_router_match_add(node);
+        /* "a/#" also matches "a" */
+        if (n->multi != 0U)
+        {
+            mqtt_router_match_add(n->multi);
+        }
+        return;
+    }
+
+    if (wildcards && (n->multi != 0U))
+    {
+        mqtt_router_match_add(n->multi);
+    }
+
+    end  = strchr(level, '/');
+    next = (end != NULL) ? (end + 1) : NULL;
+    if (end == NULL)
+    {
+        end = level + strlen(level);
+    }
+
+    child = mqtt_router_find(node, level, (u16_t)(end - level), NULL);
+    if (child != 0U)
+    {
+        mqtt_router_match_topic(child, next, true);
+    }
+
+    if (wildcards && (n->plus != 0U))
+    {
+        mqtt_router_match_topic(n->plus, next, true);
+    }
+}
+
+/*!
+ * @brief Incoming publish callback installed in the MQTT client, selects the matching routes.
+ */
+static void mqtt_router_publish_cb(void *arg, const char *topic, u32_t tot_len)
+{
+    u8_t i;
+
+    LWIP_UNUSED_ARG(arg);
+
+    router_match_cnt = 0;
+    /* Topic is NULL when it was too long for the client receive buffer */
+    if (topic != NULL)
+    {
+        mqtt_router_match_topic(MQTT_ROUTER_ROOT, topic, topic[0] != '$');
+    }
+    if (router_match_cnt == 0U)
+    {
+        router_match[router_match_cnt++] = &router_default;
+    }
+
+    for (i = 0; i < router_match_cnt; i++)
+    {
+        if (router_match[i]->pub_cb != NULL)
+        {
+            router_match[i]->pub_cb(router_match[i]->arg, topic, tot_len);
+        }
+    }
+}
+
+/*!
+ * @brief Incoming data callback installed in the MQTT client, passes data to the matching routes.
+ */
+static void mqtt_router_data_cb(void *arg, const u8_t *data, u16_t len, u8_t flags)
+{
+    u8_t i;
+
+    LWIP_UNUSED_ARG(arg);
+
+    for (i = 0; i < router_match_cnt; i++)
+    {
+        if (router_match[i]->data_cb != NULL)
+        {
+            router_match[i]->data_cb(router_match[i]->arg, data, len, flags);
+        }
+    }
+}
+
+void mqtt_router_init(mqtt_client_t *client,
+                      mqtt_incoming_publish_cb_t pub_cb,
+                      mqtt_incoming_data_cb_t data_cb,
+                      void *arg)
+{
+    memset(router_hash, 0, sizeof(router_hash));
+    memset(&router_nodes[MQTT_ROUTER_ROOT], 0, sizeof(router_nodes[MQTT_ROUTER_ROOT]));
+    router_node_cnt    = 1;
+    router_levels_len  = 0;
+    router_route_cnt   = 0;
+    router_match_cnt   = 0;
+
+    router_default.pub_cb  = pub_cb;
+    router_default.data_cb = data_cb;
+    router_default.arg     = arg;
+
+    mqtt_set_inpub_callback(client, mqtt_router_publish_cb, mqtt_router_data_cb, NULL);
+}
+
+err_t mqtt_router_add(const char *filter,
+                      mqtt_incoming_publish_cb_t pub_cb,
+                      mqtt_incoming_data_cb_t data_cb,
+                      void *arg)
+{
+    const char *level = filter;
+    const char *end;
+    u16_t node = MQTT_ROUTER_ROOT;
+    u16_t len;
+    mqtt_router_route_t *route;
+
+    if ((filter == NULL) || (filter[0] == '\0'))
+    {
+        return ERR_ARG;
+    }
+
+    for (;;)
+    {
+        end = strchr(level, '/');
+        if (end == NULL)
+        {
+            end = level + strlen(level);
+        }
+        len = (u16_t)(end - level);
+
+        if ((len == 1U) && (level[0] == '#'))
+        {
+            /* Multi level wildcard must be the last level */
+            if (*end != '\0')
+            {
+                return ERR_ARG;
+            }
+            node = mqtt_router_wildcard_child(node, &router_nodes[node].multi);
+        }
+        else if ((len == 1U) && (level[0] == '+'))
+        {
+            node = mqtt_router_wildcard_child(node, &router_nodes[node].plus);
+        }
+        else
+        {
+            /* Wildcards must occupy an entire level */
+            if ((memchr(level, '+', len) != NULL) || (memchr(level, '#', len) != NULL))
+            {
+                return ERR_ARG;
+            }
+            node = mqtt_router_level_child(node, level, len);
+        }
+
+        if (node == 0U)
+        {
+            return ERR_MEM;
+        }
+        if (*end == '\0')
+        {
+            break;
+        }
+        level = end + 1;
+    }
+
+    if (router_nodes[node].route == 0U)
+    {
+        if (router_route_cnt >= MQTT_ROUTER_ROUTES_MAX)
+        {
+            return ERR_MEM;
+        }
+        router_nodes[node].route = ++router_route_cnt;
+    }
+
+    route          = &router_routes[router_nodes[node].route - 1U];
+    route->pub_cb  = pub_cb;
+    route->data_cb = data_cb;
+    route->arg     = arg;
+
+    return ERR_OK;
+}
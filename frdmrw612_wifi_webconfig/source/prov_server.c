@@ -0,0 +1,366 @@
+/*
+ * Copyright 2025 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "prov_server.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "lwip/sockets.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "board.h"
+#include "fsl_debug_console.h"
+#include "wpl.h"
+#include "webconfig.h"
+#include "cred_flash_storage.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Length of frame header holding the frame length. */
+#define PROV_FRAME_HDR_LEN 2U
+
+#if PROV_FRAME_MAX > 0xFFFF
+#error "PROV_FRAME_MAX must fit 16 bit frame length"
+#endif
+
+/*******************************************************************************
+ * Types
+ ******************************************************************************/
+
+/*! @brief Session of connected client, incoming frame is reassembled in rx_buf across partial reads. */
+typedef struct _prov_session
+{
+    int fd;             /* -1 if the slot is free */
+    TickType_t last_rx; /* time of the last data received */
+    uint16_t rx_len;    /* number of bytes of the current frame received, including header */
+    uint16_t frame_len; /* length of the current frame, valid once the header is received */
+    uint8_t rx_buf[PROV_FRAME_HDR_LEN + PROV_FRAME_MAX];
+} prov_session_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static prov_session_t s_provSessions[PROV_SESSIONS_MAX];
+
+/*! @brief Set once credentials are stored, the board reboots at s_provRebootTick. */
+static bool s_provReboot;
+static TickType_t s_provRebootTick;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* Sends the whole buffer, blocking up to the send timeout of the socket */
+static bool prov_send_all(int fd, const uint8_t *data, uint32_t len)
+{
+    while (len > 0U)
+    {
+        int sent = send(fd, data, len, 0);
+        if (sent <= 0)
+        {
+            return false;
+        }
+
+        data += sent;
+        len -= (uint32_t)sent;
+    }
+
+    return true;
+}
+
+/* Sends response frame, data is clipped to the maximum frame length */
+static bool prov_send_response(prov_session_t *session, uint8_t type, uint8_t status, const void *data, uint32_t len)
+{
+    uint8_t hdr[PROV_FRAME_HDR_LEN + 2U];
+
+    if (len > 0xFFFFU - 2U)
+    {
+        len = 0xFFFFU - 2U;
+    }
+
+    hdr[0] = (uint8_t)((len + 2U) >> 8);
+    hdr[1] = (uint8_t)(len + 2U);
+    hdr[2] = type;
+    hdr[3] = status;
+
+    return prov_send_all(session->fd, hdr, sizeof(hdr)) && prov_send_all(session->fd, data, len);
+}
+
+/* Reads length prefixed string of a request into zero terminated buffer */
+static bool prov_get_string(const uint8_t *msg, uint16_t len, uint16_t *pos, char *str, uint32_t max_len)
+{
+    uint8_t str_len;
+
+    if (*pos >= len)
+    {
+        return false;
+    }
+
+    str_len = msg[*pos];
+    if ((str_len > max_len) || (str_len > len - *pos - 1U))
+    {
+        return false;
+    }
+
+    (void)memcpy(str, &msg[*pos + 1U], str_len);
+    str[str_len] = '\0';
+    *pos += 1U + str_len;
+
+    return true;
+}
+
+/* Handles scan request */
+static bool prov_handle_scan(prov_session_t *session)
+{
+    char *json = WPL_Scan();
+    bool ok;
+
+    if (json == NULL)
+    {
+        return prov_send_response(session, PROV_MSG_SCAN_RSP, PROV_STATUS_FAILED, NULL, 0);
+    }
+
+    ok = prov_send_response(session, PROV_MSG_SCAN_RSP, PROV_STATUS_OK, json, strlen(json));
+    vPortFree(json);
+
+    return ok;
+}
+
+/* Handles credentials request */
+static bool prov_handle_credentials(prov_session_t *session, const uint8_t *msg, uint16_t len)
+{
+    char ssid[WPL_WIFI_SSID_LENGTH + 1];
+    char passphrase[WPL_WIFI_PASSWORD_LENGTH + 1];
+    char security[WIFI_SECURITY_LENGTH + 1] = "WPA2";
+    uint16_t pos = 1U;
+
+    if (!prov_get_string(msg, len, &pos, ssid, WPL_WIFI_SSID_LENGTH) || (ssid[0] == '\0') ||
+        !prov_get_string(msg, len, &pos, passphrase, WPL_WIFI_PASSWORD_LENGTH) ||
+        ((pos < len) && !prov_get_string(msg, len, &pos, security, WIFI_SECURITY_LENGTH)) || (pos != len))
+    {
+        return prov_send_response(session, PROV_MSG_CRED_RSP, PROV_STATUS_BAD_REQUEST, NULL, 0);
+    }
+
+    PRINTF("[i] Received credentials for SSID %s\r\n", ssid);
+
+    if (save_wifi_credentials(CONNECTION_INFO_FILENAME, ssid, passphrase, security) != 0U)
+    {
+        return prov_send_response(session, PROV_MSG_CRED_RSP, PROV_STATUS_FAILED, NULL, 0);
+    }
+
+    /* Other sessions keep being served until the reboot, the last stored credentials get the highest priority.
+     * The delay runs from the first stored credentials, so further requests cannot postpone the reboot. */
+    if (!s_provReboot)
+    {
+        s_provReboot     = true;
+        s_provRebootTick = xTaskGetTickCount() + pdMS_TO_TICKS(PROV_REBOOT_DELAY_MS);
+    }
+
+    return prov_send_response(session, PROV_MSG_CRED_RSP, PROV_STATUS_OK, NULL, 0);
+}
+
+/* Handles complete request frame, returns false if the session shall be closed */
+static bool prov_handle_frame(prov_session_t *session, const uint8_t *msg, uint16_t len)
+{
+    switch (msg[0])
+    {
+        case PROV_MSG_SCAN_REQ:
+            return prov_handle_scan(session);
+
+        case PROV_MSG_CRED_REQ:
+            return prov_handle_credentials(session, msg, len);
+
+        default:
+            return prov_send_response(session, PROV_MSG_ERROR_RSP, PROV_STATUS_BAD_REQUEST, NULL, 0);
+    }
+}
+
+/* Receives available data of a session, returns false if the session shall be closed */
+static bool prov_session_recv(prov_session_t *session)
+{
+    uint32_t want;
+    int received;
+
+    /* Read up to the end of the current frame only, the next one stays in the socket */
+    if (session->rx_len < PROV_FRAME_HDR_LEN)
+    {
+        want = PROV_FRAME_HDR_LEN - session->rx_len;
+    }
+    else
+    {
+        want = PROV_FRAME_HDR_LEN + session->frame_len - session->rx_len;
+    }
+
+    received = recv(session->fd, &session->rx_buf[session->rx_len], want, MSG_DONTWAIT);
+    if (received <= 0)
+    {
+        return false;
+    }
+
+    session->rx_len += (uint16_t)received;
+    session->last_rx = xTaskGetTickCount();
+
+    if (session->rx_len == PROV_FRAME_HDR_LEN)
+    {
+        session->frame_len = (uint16_t)(((uint16_t)session->rx_buf[0] << 8) | session->rx_buf[1]);
+        if ((session->frame_len == 0U) || (session->frame_len > PROV_FRAME_MAX))
+        {
+            (void)prov_send_response(session, PROV_MSG_ERROR_RSP, PROV_STATUS_BAD_REQUEST, NULL, 0);
+            return false;
+        }
+    }
+    else if (session->rx_len == PROV_FRAME_HDR_LEN + session->frame_len)
+    {
+        session->rx_len = 0U;
+        return prov_handle_frame(session, &session->rx_buf[PROV_FRAME_HDR_LEN], session->frame_len);
+    }
+    else
+    {
+        /* Wait for the rest of the frame */
+    }
+
+    return true;
+}
+
+static void prov_session_close(prov_session_t *session)
+{
+    (void)closesocket(session->fd);
+    session->fd = -1;
+}
+
+/* Accepts new connection into a free session slot */
+static void prov_session_accept(int server_fd)
+{
+    struct timeval timeout = {.tv_sec = PROV_SEND_TIMEOUT_MS / 1000, .tv_usec = (PROV_SEND_TIMEOUT_MS % 1000) * 1000};
+    int fd;
+
+    fd = accept(server_fd, NULL, NULL);
+    if (fd < 0)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0U; i < PROV_SESSIONS_MAX; i++)
+    {
+        prov_session_t *session = &s_provSessions[i];
+        if (session->fd < 0)
+        {
+            /* A client not reading its responses must not block the others forever */
+            (void)setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+            session->fd      = fd;
+            session->rx_len  = 0U;
+            session->last_rx = xTaskGetTickCount();
+            return;
+        }
+    }
+
+    PRINTF("[!] Too many provisioning sessions\r\n");
+    (void)closesocket(fd);
+}
+
+void prov_server_task(void *arg)
+{
+    struct sockaddr_in server;
+    int server_fd;
+
+    (void)arg;
+
+    for (uint32_t i = 0U; i < PROV_SESSIONS_MAX; i++)
+    {
+        s_provSessions[i].fd = -1;
+    }
+
+    server_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (server_fd < 0)
+    {
+        PRINTF("[!] Error creating TCP socket\r\n");
+        vTaskDelete(NULL);
+    }
+
+    (void)memset(&server, 0, sizeof(server));
+    server.sin_family      = AF_INET;
+    server.sin_port        = PP_HTONS(PROV_SERVER_PORT);
+    server.sin_addr.s_addr = PP_HTONL(INADDR_ANY);
+
+    if ((bind(server_fd, (struct sockaddr *)&server, sizeof(server)) < 0) || (listen(server_fd, PROV_SESSIONS_MAX) < 0))
+    {
+        PRINTF("[!] Error in bind()\r\n");
+        closesocket(server_fd);
+        vTaskDelete(NULL);
+    }
+
+    PRINTF("Waiting for credentials %d...\r\n", PROV_SERVER_PORT);
+
+    for (;;)
+    {
+        struct timeval poll = {.tv_sec = 1, .tv_usec = 0};
+        TickType_t now;
+        fd_set rfds;
+        int max_fd = server_fd;
+
+        FD_ZERO(&rfds);
+        FD_SET(server_fd, &rfds);
+        for (uint32_t i = 0U; i < PROV_SESSIONS_MAX; i++)
+        {
+            if (s_provSessions[i].fd >= 0)
+            {
+                FD_SET(s_provSessions[i].fd, &rfds);
+                if (s_provSessions[i].fd > max_fd)
+                {
+                    max_fd = s_provSessions[i].fd;
+                }
+            }
+        }
+
+        /* Wake up periodically to expire idle sessions */
+        if (select(max_fd + 1, &rfds, NULL, NULL, &poll) < 0)
+        {
+            PRINTF("[!] Error in select()\r\n");
+            vTaskDelay(pdMS_TO_TICKS(100));
+            continue;
+        }
+
+        for (uint32_t i = 0U; i < PROV_SESSIONS_MAX; i++)
+        {
+            prov_session_t *session = &s_provSessions[i];
+            if ((session->fd >= 0) && FD_ISSET(session->fd, &rfds) && !prov_session_recv(session))
+            {
+                prov_session_close(session);
+            }
+        }
+
+        if (FD_ISSET(server_fd, &rfds))
+        {
+            prov_session_accept(server_fd);
+        }
+
+        now = xTaskGetTickCount();
+        for (uint32_t i = 0U; i < PROV_SESSIONS_MAX; i++)
+        {
+            prov_session_t *session = &s_provSessions[i];
+            if ((session->fd >= 0) && ((now - session->last_rx) > pdMS_TO_TICKS(PROV_IDLE_TIMEOUT_MS)))
+            {
+                prov_session_close(session);
+            }
+        }
+
+        if (s_provReboot && ((int32_t)(now - s_provRebootTick) >= 0))
+        {
+            PRINTF("[i] Credentials stored, rebooting...\r\n");
+            NVIC_SystemReset();
+        }
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2025 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef PROV_SERVER_H
+#define PROV_SERVER_H
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*
+ * Provisioning protocol
+ *
+ * Each message is a frame of 2 byte big endian length followed by that many bytes: message type and payload.
+ * Responses carry status byte right after the type.
+ *
+ *   PROV_MSG_SCAN_REQ  no payload
+ *   PROV_MSG_SCAN_RSP  status, scan results in JSON
+ *   PROV_MSG_CRED_REQ  ssid length, ssid, passphrase length, passphrase, optionally security length, security
+ *   PROV_MSG_CRED_RSP  status
+ *   PROV_MSG_ERROR_RSP status, sent for unknown or malformed requests
+ *
+ * Once credentials are stored the board reboots to connect to the network.
+ */
+#define PROV_MSG_SCAN_REQ  0x01U
+#define PROV_MSG_CRED_REQ  0x02U
+#define PROV_MSG_SCAN_RSP  0x81U
+#define PROV_MSG_CRED_RSP  0x82U
+#define PROV_MSG_ERROR_RSP 0xFFU
+
+#define PROV_STATUS_OK          0U
+#define PROV_STATUS_BAD_REQUEST 1U
+#define PROV_STATUS_FAILED      2U
+
+/*! @brief TCP port of the provisioning service. */
+#ifndef PROV_SERVER_PORT
+#define PROV_SERVER_PORT 10001
+#endif
+
+/*! @brief Maximum number of concurrent sessions, further connections are refused. */
+#ifndef PROV_SESSIONS_MAX
+#define PROV_SESSIONS_MAX 4
+#endif
+
+/*! @brief Maximum length of request frame. */
+#ifndef PROV_FRAME_MAX
+#define PROV_FRAME_MAX 256
+#endif
+
+/*! @brief Sessions without any data received for this long are closed. */
+#ifndef PROV_IDLE_TIMEOUT_MS
+#define PROV_IDLE_TIMEOUT_MS 30000
+#endif
+
+/*! @brief Timeout of sending response to a session. */
+#ifndef PROV_SEND_TIMEOUT_MS
+#define PROV_SEND_TIMEOUT_MS 5000
+#endif
+
+/*! @brief Delay between storing credentials and reboot, lets the response reach the client. */
+#ifndef PROV_REBOOT_DELAY_MS
+#define PROV_REBOOT_DELAY_MS 1000
+#endif
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*!
+ * @brief Provisioning server task, serves all sessions from a single task.
+ *
+ * @param arg  unused
+ */
+void prov_server_task(void *arg);
+
+#endif /* PROV_SERVER_H */
@@ -20,6 +20,7 @@
 #include "webconfig.h"
 #include "cred_flash_storage.h"
 #include "mqtt_freertos.h"
+#include "prov_server.h"
 
 #include <stdio.h>
 
@@ -50,7 +51,6 @@ static uint32_t CleanUpClient();
 #define AP_PASSWORD "my_password"
 #endif
 
-#define TCP_PORT 10001
 #define DEVICE_NAME "low_level_microcontroller"
 
 extern int wifi_set_country_code(const char *alpha2);
@@ -67,9 +67,9 @@ typedef enum board_wifi_states
 struct board_state_variables
 {
     board_wifi_states wifiState;
-    char ssid[WPL_WIFI_SSID_LENGTH];
-    char password[WPL_WIFI_PASSWORD_LENGTH];
-    char security[WIFI_SECURITY_LENGTH];
+    char ssid[WPL_WIFI_SSID_LENGTH + 1];
+    char password[WPL_WIFI_PASSWORD_LENGTH + 1];
+    char security[WIFI_SECURITY_LENGTH + 1];
     bool connected;
     TaskHandle_t mainTask;
 };
@@ -99,64 +99,6 @@ static void LinkStatusChangeCallback(bool linkState)
     }
 }
 
-static void tcp_wait_for_credentials(void *arg)
-{
-    int server_fd, client_fd;
-    struct sockaddr_in server, client;
-    socklen_t client_len = sizeof(client);
-    char buffer[128];
-
-    /* Create TCP socket */
-    server_fd = socket(AF_INET, SOCK_STREAM, 0);
-    if (server_fd < 0) {
-        PRINTF("[!] Error creating TCP socket\r\n");
-        vTaskDelete(NULL);
-    }
-
-    /* Bind on port 10001 */
-    server.sin_family = AF_INET;
-    server.sin_port = PP_HTONS(TCP_PORT);
-    server.sin_addr.s_addr = PP_HTONL(INADDR_ANY);
-
-    if (bind(server_fd, (struct sockaddr *)&server, sizeof(server)) < 0) {
-        PRINTF("[!] Error in bind()\r\n");
-        closesocket(server_fd);
-        vTaskDelete(NULL);
-    }
-
-    listen(server_fd, 1);
-    PRINTF("Waiting for credentials %d...\r\n", TCP_PORT);
-
-    client_fd = accept(server_fd, (struct sockaddr *)&client, &client_len);
-    PRINTF("[✔] Client connected\r\n");
-
-    /* SSID & PASSWORD */
-    int len = recv(client_fd, buffer, sizeof(buffer)-1, 0);
-    buffer[len] = '\0';
-    PRINTF("Received: %s\r\n", buffer);
-
-    char *ssid = strtok(buffer, ",");
-    char *password = strtok(NULL, ",");
-
-    if (ssid && password) {
-        PRINTF("SSID = %s | password = %s\r\n", ssid, password);
-
-        /* Save in Flash */
-        save_wifi_credentials(CONNECTION_INFO_FILENAME, ssid, password, "WPA2");
-        send(client_fd, "Stored. Rebooting...\n", 26, 0);
-
-        vTaskDelay(1000 / portTICK_PERIOD_MS);
-        NVIC_SystemReset();
-    } else {
-        PRINTF("[!] Invalid format\r\n");
-        send(client_fd, "ERROR\r\n", 7, 0);
-    }
-
-    closesocket(client_fd);
-    closesocket(server_fd);
-    vTaskDelete(NULL);
-}
-
 /*!
  * @brief The main task function
  */
@@ -177,9 +119,9 @@ static void main_task(void *arg)
 
     init_flash_storage(CONNECTION_INFO_FILENAME);
 
-    char ssid[WPL_WIFI_SSID_LENGTH];
-    char password[WPL_WIFI_PASSWORD_LENGTH];
-    char security[WIFI_SECURITY_LENGTH];
+    char ssid[WPL_WIFI_SSID_LENGTH + 1];
+    char password[WPL_WIFI_PASSWORD_LENGTH + 1];
+    char security[WIFI_SECURITY_LENGTH + 1];
 
     result = get_saved_wifi_credentials(CONNECTION_INFO_FILENAME, ssid, password, security);
 
@@ -274,9 +216,9 @@ static void flash_task(void *arg)
 
 	init_flash_storage(CONNECTION_INFO_FILENAME);
 
-	char ssid[WPL_WIFI_SSID_LENGTH];
-	char password[WPL_WIFI_PASSWORD_LENGTH];
-	char security[WIFI_SECURITY_LENGTH];
+	char ssid[WPL_WIFI_SSID_LENGTH + 1];
+	char password[WPL_WIFI_PASSWORD_LENGTH + 1];
+	char security[WIFI_SECURITY_LENGTH + 1];
 
 	known_network = get_saved_wifi_credentials(CONNECTION_INFO_FILENAME, ssid, password, security);
 
@@ -304,18 +246,13 @@ static void flash_task(void *arg)
 		}
 
 		PRINTF("[i] Successfully initialized Wi-Fi module\r\n");
-		int32_t joined_connection;
+		wifi_profile_t profile;
 
-		result = WPL_AddNetwork(ssid, password, WIFI_NETWORK_LABEL);
-		if (result == WPLRET_SUCCESS)
-		{
-			PRINTF("Connecting as client to ssid: %s with password %s\r\n", ssid, password);
-			result = WPL_Join(WIFI_NETWORK_LABEL);
-		}
-
-		if (result != WPLRET_SUCCESS)
+		/* Try the saved networks, using cached BSSID, channel and PMK for fast reconnect */
+		result = join_saved_wifi_profile(CONNECTION_INFO_FILENAME, WIFI_NETWORK_LABEL, &profile);
+		if (result != 0)
 		{
-			PRINTF("[!] Cannot connect to Wi-Fi\r\n[!]ssid: %s\r\n[!]passphrase: %s\r\n", ssid, password);
+			PRINTF("[!] Cannot connect to any of the saved Wi-Fi networks\r\n");
 
 			while (1)
 			{
@@ -324,7 +261,9 @@ static void flash_task(void *arg)
 		}
 		else
 		{
-			PRINTF("[i] Connected to Wi-Fi\r\nssid: %s\r\n[!]passphrase: %s\r\n", ssid, password);
+			PRINTF("[i] Connected to Wi-Fi\r\nssid: %s\r\n", profile.ssid);
+			PRINTF("[i] Time to connected: %u ms since boot\r\n",
+			       (unsigned int)(xTaskGetTickCount() * portTICK_PERIOD_MS));
 			char ip[16];
 			WPL_GetIP(ip, 1);
 		}
@@ -392,10 +331,10 @@ static void flash_task(void *arg)
 		mdns_resp_init();
 		mdns_resp_add_netif(net_get_uap_handle(), "hands_on_device");
 		mdns_resp_add_service(net_get_uap_handle(), "hands_on_device", "_echo",
-		DNSSD_PROTO_TCP, 10001, NULL, NULL);
+		DNSSD_PROTO_TCP, PROV_SERVER_PORT, NULL, NULL);
 		UNLOCK_TCPIP_CORE();
 
-		xTaskCreate(tcp_wait_for_credentials, "tcp_server", 2048, NULL, 3, NULL);
+		xTaskCreate(prov_server_task, "prov_server", 2048, NULL, 3, NULL);
 		//mqtt_freertos_run_thread(netif_default);
 
 		vTaskDelete(NULL);
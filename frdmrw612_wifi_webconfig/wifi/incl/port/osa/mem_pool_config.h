@@ -45,4 +45,7 @@ extern MemoryPool_t buf_4096_MemoryPool;
 
 int mem_pool_init();
 
+/** Print free count, high-water mark and allocation failures of each pool */
+void mem_pool_show_stats(void);
+
 #endif // _MEM_POOL_CONFIG_H_
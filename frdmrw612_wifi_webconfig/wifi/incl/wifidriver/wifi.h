@@ -1460,6 +1460,8 @@ t_u8 wifi_wmm_get_packet_cnt(void);
 /* handle EVENT_TX_DATA_PAUSE */
 void wifi_handle_event_data_pause(void *data);
 void wifi_wmm_tx_stats_dump(int bss_type);
+/* number of times and total ms senders blocked waiting for a tx buffer on an AC */
+void wifi_wmm_get_tx_wait_stats(t_u8 ac, t_u32 *wait_cnt, t_u32 *wait_ms);
 #endif /* CONFIG_WMM */
 
 int wifi_set_rssi_low_threshold(uint8_t *low_rssi);
@@ -75,13 +75,149 @@ static int CalculateItemSize(int ItemSize, int Alignment)
     return ItemSize;
 }
 
+#if defined(__ARM_FEATURE_LDREX) && ((__ARM_FEATURE_LDREX & 0x4) != 0)
+
+/**
+ *  The free list head and counters are updated with LDREX/STREX. The local
+ *  exclusive monitor is cleared on every exception entry and return, so any
+ *  preemption (task switch or ISR) between the load and the store makes the
+ *  store fail and the loop retries. That also rules out the ABA problem on
+ *  pop without a tag: the node's Next is read while the reservation on Head
+ *  is held.
+ */
+static void PoolPush(MemPool_t *MemPool, SlNode_t *Node)
+{
+    SlNode_t *head;
+    uint32_t fail;
+
+    do
+    {
+        head       = MemPool->Head;
+        Node->Next = head;
+        __DMB();
+
+        fail = 1U;
+        if ((SlNode_t *)__LDREXW((volatile uint32_t *)(void *)&MemPool->Head) == head)
+        {
+            fail = __STREXW((uint32_t)Node, (volatile uint32_t *)(void *)&MemPool->Head);
+        }
+        else
+        {
+            __CLREX();
+        }
+    } while (fail != 0U);
+}
+
+static SlNode_t *PoolPop(MemPool_t *MemPool)
+{
+    SlNode_t *head;
+    SlNode_t *next;
+
+    do
+    {
+        head = (SlNode_t *)__LDREXW((volatile uint32_t *)(void *)&MemPool->Head);
+        if (head == NULL)
+        {
+            __CLREX();
+            return NULL;
+        }
+        next = head->Next;
+    } while (__STREXW((uint32_t)next, (volatile uint32_t *)(void *)&MemPool->Head) != 0U);
+
+    __DMB();
+
+    return head;
+}
+
+static int PoolAdd(volatile int *Value, int Delta)
+{
+    int val;
+
+    do
+    {
+        val = (int)__LDREXW((volatile uint32_t *)(volatile void *)Value) + Delta;
+    } while (__STREXW((uint32_t)val, (volatile uint32_t *)(volatile void *)Value) != 0U);
+
+    return val;
+}
+
+static void PoolUpdateHighWater(MemPool_t *MemPool, int InUse)
+{
+    do
+    {
+        if ((int)__LDREXW((volatile uint32_t *)(volatile void *)&MemPool->HighWater) >= InUse)
+        {
+            __CLREX();
+            return;
+        }
+    } while (__STREXW((uint32_t)InUse, (volatile uint32_t *)(volatile void *)&MemPool->HighWater) != 0U);
+}
+
+#else
+
+/**
+ *  No exclusive access instructions on this core, fall back to a short
+ *  critical section which is still usable from ISR context.
+ */
+static void PoolPush(MemPool_t *MemPool, SlNode_t *Node)
+{
+    OSA_SR_ALLOC();
+
+    OSA_ENTER_CRITICAL();
+    Node->Next    = MemPool->Head;
+    MemPool->Head = Node;
+    OSA_EXIT_CRITICAL();
+}
+
+static SlNode_t *PoolPop(MemPool_t *MemPool)
+{
+    SlNode_t *head;
+    OSA_SR_ALLOC();
+
+    OSA_ENTER_CRITICAL();
+    head = MemPool->Head;
+    if (head != NULL)
+    {
+        MemPool->Head = head->Next;
+    }
+    OSA_EXIT_CRITICAL();
+
+    return head;
+}
+
+static int PoolAdd(volatile int *Value, int Delta)
+{
+    int val;
+    OSA_SR_ALLOC();
+
+    OSA_ENTER_CRITICAL();
+    val    = *Value + Delta;
+    *Value = val;
+    OSA_EXIT_CRITICAL();
+
+    return val;
+}
+
+static void PoolUpdateHighWater(MemPool_t *MemPool, int InUse)
+{
+    OSA_SR_ALLOC();
+
+    OSA_ENTER_CRITICAL();
+    if (MemPool->HighWater < InUse)
+    {
+        MemPool->HighWater = InUse;
+    }
+    OSA_EXIT_CRITICAL();
+}
+
+#endif
+
 MemoryPool_t OSA_MemoryPoolCreate(
     MemPool_t *MemPool, int ItemSize, void *PreallocatedMemory, int PreallocatedMemorySize, int Alignment)
 {
     /*********************************/
     unsigned char *ptr;
     SlNode_t *Node;
-    osa_status_t status;
     /*********************************/
 
     Alignment = CalculateAndVerifyAlignment(Alignment);
@@ -93,13 +229,11 @@ MemoryPool_t OSA_MemoryPoolCreate(
 
     ItemSize = CalculateItemSize(ItemSize, Alignment);
 
-    status = OSA_MutexCreate((osa_mutex_handle_t)MemPool->Lock);
-    if (status != KOSA_StatusSuccess)
-    {
-        return NULL;
-    }
-
-    InitStack(&MemPool->Stack);
+    MemPool->Head      = NULL;
+    MemPool->Count     = 0;
+    MemPool->Total     = 0;
+    MemPool->HighWater = 0;
+    MemPool->AllocFail = 0;
     MemPool->ItemSize  = ItemSize;
     MemPool->Alignment = Alignment;
 
@@ -109,7 +243,10 @@ MemoryPool_t OSA_MemoryPoolCreate(
     {
         Node = (SlNode_t *)ptr;
 
-        PushOnStack(&MemPool->Stack, Node);
+        Node->Next    = MemPool->Head;
+        MemPool->Head = Node;
+        MemPool->Count++;
+        MemPool->Total++;
         ptr += MemPool->ItemSize;
         PreallocatedMemorySize -= MemPool->ItemSize;
     }
@@ -127,23 +264,16 @@ void *OSA_MemoryPoolAllocate(MemoryPool_t pool)
 
     MemPool = (MemPool_t *)pool;
 
-    OSA_MutexLock((osa_mutex_handle_t)MemPool->Lock, osaWaitForever_c);
-
-    if (MemPool->Stack.Count == 0)
-    {
-        OSA_MutexUnlock((osa_mutex_handle_t)MemPool->Lock);
-        return NULL;
-    }
-
-    Node = PopOffStack(&MemPool->Stack);
-
-    OSA_MutexUnlock((osa_mutex_handle_t)MemPool->Lock);
+    Node = PoolPop(MemPool);
 
     if (Node == NULL)
     {
+        (void)PoolAdd((volatile int *)(volatile void *)&MemPool->AllocFail, 1);
         return NULL;
     }
 
+    PoolUpdateHighWater(MemPool, MemPool->Total - PoolAdd(&MemPool->Count, -1));
+
     ptr = ((unsigned char *)Node) + MemPool->Alignment;
 
     return (void *)ptr;
@@ -165,11 +295,30 @@ void OSA_MemoryPoolFree(MemoryPool_t pool, void *memory)
 
         Node = (SlNode_t *)ptr;
 
-        OSA_MutexLock((osa_mutex_handle_t)MemPool->Lock, osaWaitForever_c);
+        /* Counted before the node can be popped again, so Count never drops below the free nodes */
+        (void)PoolAdd(&MemPool->Count, 1);
+
+        PoolPush(MemPool, Node);
+    }
+}
+
+void OSA_MemoryPoolGetStats(MemoryPool_t pool, int *FreeCnt, int *HighWater, uint32_t *AllocFail)
+{
+    MemPool_t *MemPool = (MemPool_t *)pool;
+
+    if (FreeCnt != NULL)
+    {
+        *FreeCnt = MemPool->Count;
+    }
 
-        PushOnStack(&MemPool->Stack, Node);
+    if (HighWater != NULL)
+    {
+        *HighWater = MemPool->HighWater;
+    }
 
-        OSA_MutexUnlock((osa_mutex_handle_t)MemPool->Lock);
+    if (AllocFail != NULL)
+    {
+        *AllocFail = MemPool->AllocFail;
     }
 }
 
@@ -210,6 +359,29 @@ void OSA_MemoryPoolFree(MemoryPool_t pool, void *memory)
     tx_block_release(memory);
 }
 
+void OSA_MemoryPoolGetStats(MemoryPool_t pool, int *FreeCnt, int *HighWater, uint32_t *AllocFail)
+{
+    ULONG available = 0;
+
+    (void)tx_block_pool_info_get(pool, NULL, &available, NULL, NULL, NULL, NULL);
+
+    if (FreeCnt != NULL)
+    {
+        *FreeCnt = (int)available;
+    }
+
+    /* Not tracked by the ThreadX block pool */
+    if (HighWater != NULL)
+    {
+        *HighWater = 0;
+    }
+
+    if (AllocFail != NULL)
+    {
+        *AllocFail = 0;
+    }
+}
+
 #endif
 
 #endif
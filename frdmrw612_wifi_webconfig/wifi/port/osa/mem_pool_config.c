@@ -492,4 +492,39 @@ int mem_pool_init()
     return 0;
 }
 
+static void mem_pool_show_stat(const char *name, MemoryPool_t pool)
+{
+    int free_cnt        = 0;
+    int high_water      = 0;
+    uint32_t alloc_fail = 0;
+
+    if (pool != NULL)
+    {
+        OSA_MemoryPoolGetStats(pool, &free_cnt, &high_water, &alloc_fail);
+        (void)PRINTF("%-12s  %-10d  %-10d  %-10u\r\n", name, free_cnt, high_water, (unsigned int)alloc_fail);
+    }
+}
+
+void mem_pool_show_stats(void)
+{
+    (void)PRINTF("mem_pool_stat: \r\n");
+    (void)PRINTF("Pool          free_cnt    high_water  alloc_fail\r\n");
+
+    mem_pool_show_stat("pmAdapter", pmAdapterMemoryPool);
+    mem_pool_show_stat("pmPrivate", pmPrivateMemoryPool);
+    mem_pool_show_stat("buf_32", buf_32_MemoryPool);
+    mem_pool_show_stat("buf_128", buf_128_MemoryPool);
+    mem_pool_show_stat("buf_256", buf_256_MemoryPool);
+    mem_pool_show_stat("buf_512", buf_512_MemoryPool);
+    mem_pool_show_stat("buf_768", buf_768_MemoryPool);
+    mem_pool_show_stat("buf_1024", buf_1024_MemoryPool);
+    mem_pool_show_stat("buf_1280", buf_1280_MemoryPool);
+    mem_pool_show_stat("buf_1536", buf_1536_MemoryPool);
+    mem_pool_show_stat("buf_1792", buf_1792_MemoryPool);
+    mem_pool_show_stat("buf_2048", buf_2048_MemoryPool);
+    mem_pool_show_stat("buf_2560", buf_2560_MemoryPool);
+    mem_pool_show_stat("buf_3072", buf_3072_MemoryPool);
+    mem_pool_show_stat("buf_4096", buf_4096_MemoryPool);
+}
+
 #endif
@@ -158,6 +158,9 @@ void wrapper_deliver_amsdu_subframe(pmlan_buffer amsdu_pmbuf, t_u8 *data, t_u16
 int wrapper_wlan_set_regiontable(t_u8 region, t_u16 band);
 int wrapper_wlan_handle_rx_packet(t_u16 datalen, RxPD *rxpd, void *p, void *payload);
 int wrapper_get_wpa_ie_in_assoc(uint8_t *wpa_ie);
+#if CONFIG_TX_RX_ZERO_COPY && CONFIG_IMU_RX_ZERO_COPY && defined(RW610)
+extern void *net_rx_zerocopy_mlan_buffer(void *stack_buffer, RxPD *rxpd);
+#endif
 
 void wlan_process_hang(uint8_t fw_reload);
 
@@ -1055,6 +1058,8 @@ int wrapper_wlan_handle_rx_packet(t_u16 datalen, RxPD *rxpd, void *p, void *payl
         wifi_w("No memory available. Have to drop packet.");
         return -WM_E_NOMEM;
     }
+#elif CONFIG_IMU_RX_ZERO_COPY && defined(RW610)
+    pmlan_buffer pmbuf = (pmlan_buffer)net_rx_zerocopy_mlan_buffer(p, rxpd);
 #else
     pmlan_buffer pmbuf = (pmlan_buffer)((t_u8 *)rxpd - INTF_HEADER_LEN - sizeof(mlan_buffer));
 #endif
@@ -5312,6 +5317,8 @@ static inline void wifi_wmm_trigger_tx(t_u8 tx_pause)
     if (tx_pause == MFALSE)
     {
         send_wifi_driver_tx_data_event(MLAN_BSS_TYPE_STA);
+        /* Senders blocked on a paused RA may retry now */
+        wifi_wmm_outbuf_notify();
     }
 }
 
@@ -8294,6 +8301,19 @@ static void wifi_wmm_tx_stats_dump_ralist(mlan_list_head *ra_list_head)
     }
 }
 
+void wifi_wmm_get_tx_wait_stats(t_u8 ac, t_u32 *wait_cnt, t_u32 *wait_ms)
+{
+    if (ac >= MAX_AC_QUEUES)
+    {
+        *wait_cnt = 0;
+        *wait_ms  = 0;
+        return;
+    }
+
+    *wait_cnt = mlan_adap->outbuf_pool.wait_cnt[ac];
+    *wait_ms  = mlan_adap->outbuf_pool.wait_ms[ac];
+}
+
 void wifi_wmm_tx_stats_dump(int bss_type)
 {
     int i;
@@ -8339,6 +8359,12 @@ void wifi_wmm_tx_stats_dump(int bss_type)
     mlan_adap->callbacks.moal_semaphore_put(mlan_adap->pmoal_handle, &mlan_adap->outbuf_pool.free_list.plock);
     wifi_w("TX buffer pool: free_cnt[%d] real_free_cnt[%d]", mlan_adap->outbuf_pool.free_cnt, free_cnt_real);
 
+    for (i = 0; i < MAX_AC_QUEUES; i++)
+    {
+        wifi_w("TX buffer wait ac[%d]: cnt[%u] ms[%u]", i, (unsigned int)mlan_adap->outbuf_pool.wait_cnt[i],
+               (unsigned int)mlan_adap->outbuf_pool.wait_ms[i]);
+    }
+
 #if CONFIG_WMM_DEBUG
     for (i = 0; i < MAX_AC_QUEUES; i++)
     {
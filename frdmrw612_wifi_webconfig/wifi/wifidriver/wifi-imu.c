@@ -133,6 +133,10 @@ IMUPkt *imupkt = (IMUPkt *)outbuf;
 #if CONFIG_TX_RX_ZERO_COPY
 extern void net_tx_zerocopy_process_cb(void *destAddr, void *srcAddr, uint32_t len);
 #endif
+#if CONFIG_TX_RX_ZERO_COPY && CONFIG_IMU_RX_ZERO_COPY
+/* Set by the data input path when it keeps the rx buffer being processed */
+static bool imu_rx_buf_held;
+#endif
 void wrapper_wlan_cmd_11n_cfg(void *hostcmd);
 void wrapper_wifi_ret_mib(void *resp);
 uint32_t dev_value1 = -1;
@@ -1578,11 +1582,21 @@ hal_imumc_status_t imumc_rxpkt_handler(IMU_Msg_t *pImuMsg, uint32_t length)
         wifi_io_info_d("IN: i/f: %d len: %d", interface, size);
         w_pkt_d("Data RX: FW=>Driver, if %d, len %d", interface, size);
 
+#if CONFIG_TX_RX_ZERO_COPY && CONFIG_IMU_RX_ZERO_COPY
+        imu_rx_buf_held = false;
+#endif
         if (bus.wifi_low_level_input != NULL)
 #if CONFIG_TX_RX_ZERO_COPY
             bus.wifi_low_level_input(interface, (uint8_t *)inimupkt, size);
 #else
             bus.wifi_low_level_input(interface, inbuf, size);
+#endif
+#if CONFIG_TX_RX_ZERO_COPY && CONFIG_IMU_RX_ZERO_COPY
+        if (imu_rx_buf_held)
+        {
+            /* Buffer now belongs to the net stack, it is returned by wifi_imu_return_rx_buf() */
+            pImuMsg->PayloadPtr[i] = 0U;
+        }
 #endif
     }
 #if CONFIG_HOST_SLEEP
@@ -1592,6 +1606,21 @@ hal_imumc_status_t imumc_rxpkt_handler(IMU_Msg_t *pImuMsg, uint32_t length)
     return kStatus_HAL_ImumcSuccess;
 }
 
+#if CONFIG_TX_RX_ZERO_COPY && CONFIG_IMU_RX_ZERO_COPY
+void wifi_imu_hold_rx_buf(void)
+{
+    imu_rx_buf_held = true;
+}
+
+void wifi_imu_return_rx_buf(t_u8 *buf)
+{
+    if (HAL_ImuReturnRxBuf(kIMU_LinkCpu1Cpu3, buf) != kStatus_HAL_ImumcSuccess)
+    {
+        wifi_io_e("Failed to return rx buffer %p", buf);
+    }
+}
+#endif
+
 static bool imu_fw_is_hang(void)
 {
     uint32_t *peer_magic_addr = (uint32_t *)0x41380000;
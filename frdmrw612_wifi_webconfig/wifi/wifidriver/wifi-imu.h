@@ -127,6 +127,20 @@ mlan_status wlan_xmit_wmm_amsdu_pkt(mlan_wmm_ac_e ac, t_u8 interface, t_u32 txle
 #endif
 #endif
 
+#if CONFIG_TX_RX_ZERO_COPY && CONFIG_IMU_RX_ZERO_COPY
+/*
+ * @internal
+ * Keep the IMU rx buffer currently passed to the data input callback,
+ * it must be released later with wifi_imu_return_rx_buf().
+ */
+void wifi_imu_hold_rx_buf(void);
+
+/*
+ * @internal
+ */
+void wifi_imu_return_rx_buf(t_u8 *buf);
+#endif
+
 void imu_wakeup_card(void);
 #if CONFIG_WIFI_TX_BUFF
 int _wlan_return_all_tx_buf(imu_link_t link);
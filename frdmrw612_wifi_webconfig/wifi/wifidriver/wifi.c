@@ -84,6 +84,8 @@ uint32_t wm_rand_seed = 0xFFFFFFFFU;
 
 #if CONFIG_WMM
 OSA_SEMAPHORE_HANDLE_DEFINE(txbuf_sem);
+/* Signalled when a wmm tx buffer is put back or a paused RA is resumed */
+OSA_EVENT_HANDLE_DEFINE(txbuf_avail_event);
 #endif
 
 #if CONFIG_STA_AMPDU_TX
@@ -2243,6 +2245,13 @@ static int wifi_core_init(void)
         return ret;
     }
 
+    status = OSA_EventCreate((osa_event_handle_t)txbuf_avail_event, 1);
+    if (status != KOSA_StatusSuccess)
+    {
+        wifi_e("Create txbuf event failed");
+        goto fail;
+    }
+
     /* Semaphore to protect wmm data parameters */
     status = OSA_SemaphoreCreateBinary((osa_semaphore_handle_t)wm_wifi.tx_data_sem);
     if (status != KOSA_StatusSuccess)
@@ -2355,6 +2364,7 @@ static void wifi_core_deinit(void)
     wifi_bypass_txq_deinit();
 
     (void)OSA_SemaphoreDestroy((osa_semaphore_handle_t)txbuf_sem);
+    (void)OSA_EventDestroy((osa_event_handle_t)txbuf_avail_event);
 #endif
 
     wifi_remove_all_mcast_filter(0);
@@ -4940,6 +4950,10 @@ void wifi_show_os_mem_stat()
                      wifi_os_mem_stat[index].line_num, wifi_os_mem_stat[index].size, wifi_os_mem_stat[index].alloc_cnt,
                      wifi_os_mem_stat[index].free_cnt);
     }
+
+#if CONFIG_MEM_POOLS
+    mem_pool_show_stats();
+#endif
 }
 #endif
 